@@ -0,0 +1,44 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  constexpr usize arena_size = 1 << 20;
+  constexpr usize count = 1024;
+}
+
+KTA_BENCHMARK("BumpAllocator/allocate_bytes") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  state.set_items_per_op(count);
+
+  for(const usize size : {usize(8), usize(64), usize(200)}) {
+    state.run(std::to_string(size), [&] {
+      BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+      for(usize i = 0; i < count; i++) do_not_optimize(arena.allocate_bytes(16, size));
+    });
+  }
+}
+
+KTA_BENCHMARK("BumpAllocator/allocate") {
+  struct Node { Node* next; uint64 key; uint32 value; };
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  state.set_items_per_op(count);
+
+  state.run([&] {
+    BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+    Node* head = nullptr;
+    for(usize i = 0; i < count; i++) head = arena.allocate<Node>(head, i, static_cast<uint32>(i));
+    do_not_optimize(head);
+  });
+}
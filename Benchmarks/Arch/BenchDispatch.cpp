@@ -0,0 +1,36 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+#include <Kalantha/Arch/Generic/CpuTopology.hpp>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  NOINLINE_ auto add_one(uint64 value) -> uint64 {
+    return value + 1;
+  }
+
+  inline constinit Dispatch<uint64(uint64)> add_one_dispatch{&add_one};
+}
+
+/// The overhead a Dispatch adds over calling the variant directly.
+KTA_BENCHMARK("Dispatch/call") {
+  uint64 value = 0;
+  state.run("direct", [&] { value = add_one(value); do_not_optimize(value); });
+  state.run("dispatch", [&] { value = add_one_dispatch(value); do_not_optimize(value); });
+}
+
+/// Both are cached after the first call, so these should be a few loads.
+KTA_BENCHMARK("Dispatch/cached_queries") {
+  state.run("simd_tier", [] { do_not_optimize(simd_tier()); });
+  state.run("cpu_topology", [] { do_not_optimize(cpu_topology().line_size()); });
+#  if defined(ARCH_X86_64)
+  state.run("cpu_features", [] { do_not_optimize(x86_64::cpu_features().has_avx2()); });
+#  endif
+}
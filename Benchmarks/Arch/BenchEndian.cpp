@@ -0,0 +1,62 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Arch/Generic/Endian.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  template<typename T>
+  auto bench_byteswap(State& state, const char* type) -> void {
+    for(const usize bytes : {usize(256), usize(16384), usize(1) << 20}) {
+      const usize n = bytes / sizeof(T);
+      std::vector<T> src(n), dst(n);
+      Rng rng;
+      for(auto& value : src) value = static_cast<T>(rng.next());
+
+      state.set_bytes_per_op(bytes);
+      state.run(std::string(type) + "/in_place/" + std::to_string(bytes), [&] {
+        byteswap(Span<T>(src.data(), n));
+        do_not_optimize(src.data());
+      });
+
+      state.run(std::string(type) + "/copy/" + std::to_string(bytes), [&] {
+        byteswap(Span<const T>(src.data(), n), Span<T>(dst.data(), n));
+        do_not_optimize(dst.data());
+      });
+    }
+  }
+}
+
+KTA_BENCHMARK("Endian/byteswap") {
+  bench_byteswap<uint16>(state, "uint16");
+  bench_byteswap<uint32>(state, "uint32");
+  bench_byteswap<uint64>(state, "uint64");
+}
+
+KTA_BENCHMARK("Endian/load_store_big") {
+  uint8 buffer[1024 + 8];
+  Rng rng;
+  for(auto& b : buffer) b = static_cast<uint8>(rng.next());
+
+  /// Unaligned on purpose: wire formats don't line anything up.
+  state.set_items_per_op(1024);
+  state.run("load/uint32", [&] {
+    uint32 total = 0;
+    for(usize i = 0; i < 1024; i++) total += load_big<uint32>(buffer + i);
+    do_not_optimize(total);
+  });
+
+  state.run("store/uint64", [&] {
+    for(usize i = 0; i < 1024; i++) store_big<uint64>(buffer + i, i);
+    do_not_optimize(buffer);
+  });
+}
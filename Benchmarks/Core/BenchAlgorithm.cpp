@@ -0,0 +1,168 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Algorithm.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  auto make_keys(usize n) -> std::vector<uint32> {
+    Rng rng;
+    std::vector<uint32> keys(n);
+    for(auto& key : keys) key = static_cast<uint32>(rng.next());
+    return keys;
+  }
+
+  constexpr usize sort_sizes[]   = {16, 1024, 65536, 1 << 20};
+  constexpr usize reduce_sizes[] = {64, 4096, 1 << 20};
+}
+
+/// Every call sorts a fresh copy of the input, so the copy is part of the time.
+KTA_BENCHMARK("Algorithm/sort") {
+  for(const usize n : sort_sizes) {
+    const auto input = make_keys(n);
+    std::vector<uint32> keys(n);
+    std::vector<uint32> scratch(n);
+    state.set_items_per_op(n);
+
+    state.run("pdq/" + std::to_string(n), [&] {
+      std::memcpy(keys.data(), input.data(), n * sizeof(uint32));
+      kta::sort(Span<uint32>(keys.data(), n));
+    });
+
+    state.run("stable/" + std::to_string(n), [&] {
+      std::memcpy(keys.data(), input.data(), n * sizeof(uint32));
+      stable_sort(Span<uint32>(keys.data(), n), Span<uint32>(scratch.data(), n));
+    });
+
+    state.run("radix/" + std::to_string(n), [&] {
+      std::memcpy(keys.data(), input.data(), n * sizeof(uint32));
+      radix_sort(Span<uint32>(keys.data(), n), Span<uint32>(scratch.data(), n));
+    });
+  }
+}
+
+/// The inputs that trip up quicksorts: already sorted, reversed, and
+/// only a handful of distinct keys, next to the random baseline.
+KTA_BENCHMARK("Algorithm/sort_patterns") {
+  constexpr usize n = 1 << 20;
+  std::vector<uint32> keys(n);
+  std::vector<uint32> scratch(n);
+  state.set_items_per_op(n);
+
+  for(const char* pattern : {"random", "sorted", "reverse", "dups"}) {
+    auto input = make_keys(n);
+    if(std::strcmp(pattern, "sorted") == 0) {
+      std::sort(input.begin(), input.end());
+    } else if(std::strcmp(pattern, "reverse") == 0) {
+      std::sort(input.begin(), input.end(), [](uint32 a, uint32 b) { return a > b; });
+    } else if(std::strcmp(pattern, "dups") == 0) {
+      for(auto& key : input) key %= 16;
+    }
+
+    state.run(std::string("pdq/") + pattern, [&] {
+      std::memcpy(keys.data(), input.data(), n * sizeof(uint32));
+      kta::sort(Span<uint32>(keys.data(), n));
+    });
+
+    state.run(std::string("radix/") + pattern, [&] {
+      std::memcpy(keys.data(), input.data(), n * sizeof(uint32));
+      radix_sort(Span<uint32>(keys.data(), n), Span<uint32>(scratch.data(), n));
+    });
+
+    state.run(std::string("std_sort/") + pattern, [&] {
+      std::memcpy(keys.data(), input.data(), n * sizeof(uint32));
+      std::sort(keys.begin(), keys.end());
+    });
+  }
+}
+
+KTA_BENCHMARK("Algorithm/lower_bound") {
+  for(const usize n : {usize(64), usize(4096), usize(1 << 20)}) {
+    auto keys = make_keys(n);
+    kta::sort(Span<uint32>(keys.data(), n));
+    const auto needles = make_keys(256);
+
+    state.set_items_per_op(needles.size());
+    state.run(std::to_string(n), [&] {
+      for(const uint32 needle : needles) {
+        usize index = lower_bound(Span<const uint32>(keys.data(), n), needle);
+        do_not_optimize(index);
+      }
+    });
+  }
+}
+
+KTA_BENCHMARK("Algorithm/reduce") {
+  for(const usize n : reduce_sizes) {
+    const auto keys = make_keys(n);
+    const Span<const uint32> span(keys.data(), n);
+    state.set_bytes_per_op(n * sizeof(uint32));
+
+    state.run("sum/" + std::to_string(n), [&] {
+      auto total = sum(span);
+      do_not_optimize(total);
+    });
+
+    state.run("minmax/" + std::to_string(n), [&] {
+      auto extremes = minmax(span);
+      do_not_optimize(extremes);
+    });
+
+    state.run("min_element/" + std::to_string(n), [&] {
+      usize index = min_element(span);
+      do_not_optimize(index);
+    });
+
+    state.run("max_element/" + std::to_string(n), [&] {
+      usize index = max_element(span);
+      do_not_optimize(index);
+    });
+
+    state.run("std_min_element/" + std::to_string(n), [&] {
+      auto it = std::min_element(keys.begin(), keys.end());
+      do_not_optimize(it);
+    });
+
+    state.run("std_max_element/" + std::to_string(n), [&] {
+      auto it = std::max_element(keys.begin(), keys.end());
+      do_not_optimize(it);
+    });
+
+    state.run("std_accumulate/" + std::to_string(n), [&] {
+      uint64 total = std::accumulate(keys.begin(), keys.end(), uint64(0));
+      do_not_optimize(total);
+    });
+
+    state.run("count/" + std::to_string(n), [&] {
+      usize found = count(span, keys[n / 2]);
+      do_not_optimize(found);
+    });
+
+    state.run("reduce_generic/" + std::to_string(n), [&] {
+      uint64 total = reduce(span, uint64(0));
+      do_not_optimize(total);
+    });
+  }
+}
+
+KTA_BENCHMARK("Algorithm/inclusive_scan") {
+  const usize n = 4096;
+  const auto keys = make_keys(n);
+  std::vector<uint64> out(n);
+  state.set_items_per_op(n);
+  state.run([&] {
+    inclusive_scan(Span<const uint32>(keys.data(), n), Span<uint64>(out.data(), n));
+  });
+}
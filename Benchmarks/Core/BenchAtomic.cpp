@@ -0,0 +1,38 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+
+using namespace kta;
+using namespace kta::bench;
+
+/// Single threaded, so these are the uncontended costs of each operation.
+
+KTA_BENCHMARK("Atomic/fetch_add") {
+  Atomic<uint64> counter{0};
+  state.run("relaxed", [&] { do_not_optimize(counter.fetch_add(1, MemoryOrder::Relaxed)); });
+  state.run("acq_rel", [&] { do_not_optimize(counter.fetch_add(1, MemoryOrder::AcqRel)); });
+  state.run("seq_cst", [&] { do_not_optimize(counter.fetch_add(1, MemoryOrder::SeqCst)); });
+}
+
+KTA_BENCHMARK("Atomic/store") {
+  Atomic<uint64> value{0};
+  uint64 next = 0;
+  state.run("relaxed", [&] { value.store(next++, MemoryOrder::Relaxed); clobber_memory(); });
+  state.run("release", [&] { value.store(next++, MemoryOrder::Release); clobber_memory(); });
+  state.run("seq_cst", [&] { value.store(next++, MemoryOrder::SeqCst);  clobber_memory(); });
+}
+
+KTA_BENCHMARK("Atomic/compare_exchange") {
+  Atomic<uint64> value{0};
+  uint64 expected = 0;
+  state.run([&] {
+    const bool swapped = value.compare_exchange_strong(expected, expected + 1, MemoryOrder::AcqRel, MemoryOrder::Relaxed);
+    do_not_optimize(swapped);
+    expected++;
+  });
+}
@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/ByteStream.hpp>
+#include <Kalantha/Arch/Generic/Endian.hpp>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  /// A 20 field wire message: a mix of widths, big endian like most protocols.
+  struct Message {
+    uint64 id, timestamp, sequence, account, price, quantity, flags_a, flags_b;
+    uint32 venue, symbol, side, kind, tif, reserved_a, reserved_b, checksum;
+    uint16 version, length;
+    uint8  priority, channel;
+  };
+
+  constexpr usize message_size = 8 * 8 + 8 * 4 + 2 * 2 + 2 * 1;
+
+  auto make_message() -> Message {
+    Rng rng;
+    Message m{};
+    m.id = rng.next(); m.timestamp = rng.next(); m.sequence = rng.next(); m.account = rng.next();
+    m.price = rng.next(); m.quantity = rng.next(); m.flags_a = rng.next(); m.flags_b = rng.next();
+    m.venue = 1; m.symbol = 2; m.side = 3; m.kind = 4; m.tif = 5; m.reserved_a = 6; m.reserved_b = 7; m.checksum = 8;
+    m.version = 9; m.length = message_size;
+    m.priority = 10; m.channel = 11;
+    return m;
+  }
+
+  auto encode(ByteWriter& w, const Message& m) -> void {
+    w.put_big(m.id);    w.put_big(m.timestamp); w.put_big(m.sequence); w.put_big(m.account);
+    w.put_big(m.price); w.put_big(m.quantity);  w.put_big(m.flags_a);  w.put_big(m.flags_b);
+    w.put_big(m.venue); w.put_big(m.symbol); w.put_big(m.side); w.put_big(m.kind);
+    w.put_big(m.tif);   w.put_big(m.reserved_a); w.put_big(m.reserved_b); w.put_big(m.checksum);
+    w.put_big(m.version); w.put_big(m.length);
+    w.put_big(m.priority); w.put_big(m.channel);
+  }
+
+  auto decode(ByteReader& r, Message& m) -> void {
+    m.id = r.get_big<uint64>();    m.timestamp = r.get_big<uint64>(); m.sequence = r.get_big<uint64>();
+    m.account = r.get_big<uint64>(); m.price = r.get_big<uint64>();   m.quantity = r.get_big<uint64>();
+    m.flags_a = r.get_big<uint64>(); m.flags_b = r.get_big<uint64>();
+    m.venue = r.get_big<uint32>(); m.symbol = r.get_big<uint32>(); m.side = r.get_big<uint32>();
+    m.kind = r.get_big<uint32>();  m.tif = r.get_big<uint32>();    m.reserved_a = r.get_big<uint32>();
+    m.reserved_b = r.get_big<uint32>(); m.checksum = r.get_big<uint32>();
+    m.version = r.get_big<uint16>(); m.length = r.get_big<uint16>();
+    m.priority = r.get_big<uint8>(); m.channel = r.get_big<uint8>();
+  }
+}
+
+KTA_BENCHMARK("ByteStream/message") {
+  Message message = make_message();
+  uint8 buffer[message_size];
+  state.set_bytes_per_op(message_size);
+
+  state.run("encode", [&] {
+    do_not_optimize(message);
+    ByteWriter writer(Span<uint8>(buffer, message_size));
+    if(writer.ensure(message_size).has_value()) encode(writer, message);
+    do_not_optimize(buffer);
+  });
+
+  state.run("decode", [&] {
+    do_not_optimize(buffer);
+    ByteReader reader(Span<const uint8>(buffer, message_size));
+    if(reader.ensure(message_size).has_value()) decode(reader, message);
+    do_not_optimize(message);
+  });
+
+  /// The same message with store_big/load_big at hand-computed offsets, as a baseline.
+  state.run("encode_manual", [&] {
+    do_not_optimize(message);
+    uint8* p = buffer;
+    store_big(p, message.id); store_big(p + 8, message.timestamp); store_big(p + 16, message.sequence);
+    store_big(p + 24, message.account); store_big(p + 32, message.price); store_big(p + 40, message.quantity);
+    store_big(p + 48, message.flags_a); store_big(p + 56, message.flags_b);
+    store_big(p + 64, message.venue); store_big(p + 68, message.symbol); store_big(p + 72, message.side);
+    store_big(p + 76, message.kind); store_big(p + 80, message.tif); store_big(p + 84, message.reserved_a);
+    store_big(p + 88, message.reserved_b); store_big(p + 92, message.checksum);
+    store_big(p + 96, message.version); store_big(p + 98, message.length);
+    store_big(p + 100, message.priority); store_big(p + 101, message.channel);
+    do_not_optimize(buffer);
+  });
+}
@@ -0,0 +1,95 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/CharConv.hpp>
+#include <Kalantha/Core/StringView.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  constexpr usize count = 256;
+
+  /// Values with 1 to max_digits decimal digits, evenly spread.
+  auto make_values(int max_digits) -> std::vector<int64> {
+    Rng rng;
+    std::vector<int64> values(count);
+    for(auto& value : values) {
+      int64 limit = 1;
+      const int digits = static_cast<int>(rng.below(max_digits)) + 1;
+      for(int d = 0; d < digits; d++) limit *= 10;
+      value = static_cast<int64>(rng.below(static_cast<uint64>(limit)));
+    }
+    return values;
+  }
+
+  auto make_strings(const std::vector<int64>& values, int base) -> std::vector<std::string> {
+    std::vector<std::string> strings;
+    for(const int64 value : values) {
+      char buff[40]{};
+      Span<char> span(buff);
+      const usize len = to_chars(value, span, base).value();
+      strings.emplace_back(buff, len);
+    }
+    return strings;
+  }
+}
+
+KTA_BENCHMARK("CharConv/to_chars") {
+  state.set_items_per_op(count);
+  for(int digits : {2, 9, 18}) {
+    const auto values = make_values(digits);
+    for(int base : {BaseDec, BaseHex}) {
+      state.run("base" + std::to_string(base) + "/digits" + std::to_string(digits), [&] {
+        for(const int64 value : values) {
+          char buff[40];
+          Span<char> span(buff);
+          auto res = to_chars(value, span, base);
+          do_not_optimize(res);
+          do_not_optimize(buff);
+        }
+      });
+    }
+  }
+}
+
+KTA_BENCHMARK("CharConv/from_chars") {
+  state.set_items_per_op(count);
+  for(int digits : {2, 9, 18}) {
+    const auto values = make_values(digits);
+    for(int base : {BaseDec, BaseHex}) {
+      const auto strings = make_strings(values, base);
+      state.run("base" + std::to_string(base) + "/digits" + std::to_string(digits), [&] {
+        for(const auto& str : strings) {
+          int64 out = 0;
+          auto res = from_chars(StringView(str.data(), str.size()), out, base);
+          do_not_optimize(res);
+          do_not_optimize(out);
+        }
+      });
+    }
+  }
+}
+
+KTA_BENCHMARK("StringView/equal") {
+  for(usize len : {8, 64, 1024}) {
+    const std::string a(len, 'x');
+    std::string b = a;
+    state.set_bytes_per_op(len);
+    state.run(std::to_string(len), [&] {
+      StringView lhs(a.data(), a.size());
+      StringView rhs(b.data(), b.size());
+      do_not_optimize(lhs);
+      do_not_optimize(rhs);
+      bool equal = lhs == rhs;
+      do_not_optimize(equal);
+    });
+  }
+}
@@ -0,0 +1,153 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/FlatHashMap.hpp>
+#include <Kalantha/Core/FlatHashSet.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  constexpr usize arena_size = 64 << 20;
+
+  /// 1K to 100M entries; the sweeps stop at --max-elements.
+  constexpr usize map_sizes[] = {1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000};
+
+  /// Enough for a map of n uint64 pairs grown from empty. A bump arena
+  /// never gets the old tables back, so that's every table on the way
+  /// up, each at most 7/8 full, with 17 bytes per slot.
+  constexpr auto map_arena_size(usize n) -> usize {
+    return n * 96 + (usize(1) << 20);
+  }
+
+  auto make_keys(usize n, uint64 seed) -> std::vector<uint64> {
+    Rng rng(seed);
+    std::vector<uint64> keys(n);
+    for(auto& key : keys) key = rng.next();
+    return keys;
+  }
+}
+
+KTA_BENCHMARK("FlatHashMap/insert") {
+  for(const usize n : map_sizes) {
+    if(n > state.max_elements()) break;
+
+    const usize size = map_arena_size(n);
+    auto buffer = std::make_unique_for_overwrite<uint8[]>(size);
+    const auto keys = make_keys(n, 1);
+    state.set_items_per_op(n);
+
+    /// Every call builds a new map in a fresh arena, growing from empty.
+    state.run(std::to_string(n), [&] {
+      BumpAllocator arena(buffer.get(), buffer.get() + size);
+      FlatHashMap<uint64, uint64> map(&arena);
+      for(const uint64 key : keys) {
+        auto res = map.emplace(key, key);
+        do_not_optimize(res);
+      }
+    });
+
+    state.run("reserved/" + std::to_string(n), [&] {
+      BumpAllocator arena(buffer.get(), buffer.get() + size);
+      FlatHashMap<uint64, uint64> map(&arena);
+      if(!map.reserve(n).has_value()) return;
+      for(const uint64 key : keys) {
+        auto res = map.emplace(key, key);
+        do_not_optimize(res);
+      }
+    });
+  }
+}
+
+KTA_BENCHMARK("FlatHashMap/find") {
+  for(const usize n : map_sizes) {
+    if(n > state.max_elements()) break;
+
+    const usize size = map_arena_size(n);
+    auto buffer = std::make_unique_for_overwrite<uint8[]>(size);
+    BumpAllocator arena(buffer.get(), buffer.get() + size);
+    FlatHashMap<uint64, uint64> map(&arena);
+    const auto keys   = make_keys(n, 1);
+    const auto misses = make_keys(1024, 2);
+    if(!map.reserve(n).has_value()) return;
+    for(const uint64 key : keys) (void)map.emplace(key, key);
+
+    std::vector<uint64> hits(1024);
+    Rng rng;
+    for(auto& hit : hits) hit = keys[rng.below(n)];
+
+    state.set_items_per_op(1024);
+    state.run("hit/" + std::to_string(n), [&] {
+      for(const uint64 key : hits) {
+        uint64* value = map.find(key);
+        do_not_optimize(value);
+      }
+    });
+
+    state.run("miss/" + std::to_string(n), [&] {
+      for(const uint64 key : misses) {
+        uint64* value = map.find(key);
+        do_not_optimize(value);
+      }
+    });
+  }
+}
+
+/// Erases 1024 random keys and puts them back, so every call starts
+/// from the same full map. The items are the erases.
+KTA_BENCHMARK("FlatHashMap/erase") {
+  for(const usize n : map_sizes) {
+    if(n > state.max_elements()) break;
+
+    const usize size = map_arena_size(n);
+    auto buffer = std::make_unique_for_overwrite<uint8[]>(size);
+    BumpAllocator arena(buffer.get(), buffer.get() + size);
+    FlatHashMap<uint64, uint64> map(&arena);
+    const auto keys = make_keys(n, 1);
+    if(!map.reserve(n).has_value()) return;
+    for(const uint64 key : keys) (void)map.emplace(key, key);
+
+    /// Distinct, so every erase finds its key.
+    std::vector<uint64> victims;
+    const usize stride = n / 1024 != 0 ? n / 1024 : 1;
+    for(usize i = 0; i < n && victims.size() < 1024; i += stride) victims.push_back(keys[i]);
+
+    state.set_items_per_op(victims.size());
+    state.run("erase_reinsert/" + std::to_string(n), [&] {
+      for(const uint64 key : victims) {
+        bool erased = map.erase(key);
+        do_not_optimize(erased);
+      }
+      for(const uint64 key : victims) {
+        auto res = map.emplace(key, key);
+        do_not_optimize(res);
+      }
+    });
+  }
+}
+
+KTA_BENCHMARK("FlatHashSet/insert_contains") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  const usize n = 4096;
+  const auto keys = make_keys(n, 3);
+  state.set_items_per_op(n);
+
+  state.run([&] {
+    BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+    FlatHashSet<uint64> set(&arena);
+    for(const uint64 key : keys) (void)set.insert(key);
+    for(const uint64 key : keys) {
+      bool found = set.contains(key);
+      do_not_optimize(found);
+    }
+  });
+}
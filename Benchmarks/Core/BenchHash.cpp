@@ -0,0 +1,66 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Hash.hpp>
+#include <Kalantha/Core/CRC32C.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  auto make_bytes(usize n) -> std::vector<uint8> {
+    Rng rng;
+    std::vector<uint8> bytes(n);
+    for(auto& byte : bytes) byte = static_cast<uint8>(rng.next());
+    return bytes;
+  }
+
+  constexpr usize sizes[] = {8, 16, 64, 256, 1024, 4096, 65536, 1 << 20};
+}
+
+KTA_BENCHMARK("Hash/hash_bytes") {
+  const auto bytes = make_bytes(sizes[sizeof(sizes) / sizeof(sizes[0]) - 1]);
+  for(const usize size : sizes) {
+    state.set_bytes_per_op(size);
+    state.run(std::to_string(size), [&] {
+      const uint8* data = bytes.data();
+      do_not_optimize(data);
+      uint64 h = hash_bytes(data, size);
+      do_not_optimize(h);
+    });
+  }
+}
+
+KTA_BENCHMARK("Hash/hash_uint64") {
+  uint64 keys[256];
+  Rng rng;
+  for(auto& key : keys) key = rng.next();
+
+  state.set_items_per_op(256);
+  state.run([&] {
+    for(const uint64 key : keys) {
+      uint64 h = hash(key);
+      do_not_optimize(h);
+    }
+  });
+}
+
+KTA_BENCHMARK("CRC32C/crc32c") {
+  const auto bytes = make_bytes(sizes[sizeof(sizes) / sizeof(sizes[0]) - 1]);
+  for(const usize size : sizes) {
+    state.set_bytes_per_op(size);
+    state.run(std::to_string(size), [&] {
+      const uint8* data = bytes.data();
+      do_not_optimize(data);
+      uint32 crc = crc32c(data, size);
+      do_not_optimize(crc);
+    });
+  }
+}
@@ -0,0 +1,127 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Locks.hpp>
+#include <Kalantha/Core/SeqLock.hpp>
+
+#include <string>
+
+using namespace kta;
+using namespace kta::bench;
+
+/// Uncontended lock + unlock pairs: the floor every critical section pays.
+
+KTA_BENCHMARK("Locks/lock_unlock") {
+  uint64 shared = 0;
+
+  SpinLock spin;
+  state.run("spin", [&] {
+    LockGuard guard(spin);
+    shared++;
+    clobber_memory();
+  });
+
+  TicketLock ticket;
+  state.run("ticket", [&] {
+    LockGuard guard(ticket);
+    shared++;
+    clobber_memory();
+  });
+
+  McsLock mcs;
+  state.run("mcs", [&] {
+    LockGuard guard(mcs);
+    shared++;
+    clobber_memory();
+  });
+
+  do_not_optimize(shared);
+}
+
+KTA_BENCHMARK("SeqLock") {
+  struct Quote { uint64 bid, ask, bid_size, ask_size; };
+  SeqLock<Quote> lock;
+  uint64 next = 0;
+
+  state.run("store", [&] {
+    lock.store(Quote{next, next + 1, next + 2, next + 3});
+    next++;
+    clobber_memory();
+  });
+
+  state.run("load", [&] {
+    const Quote quote = lock.load();
+    do_not_optimize(quote);
+  });
+}
+
+#  if defined(KTA_HAS_PTHREADS_)
+namespace {
+  constexpr usize round_items = 4096;
+
+  /// Every thread takes the lock round_items times around a tiny critical section.
+  template<typename Lock>
+  auto run_contended(State& state, const char* name, usize threads) -> void {
+    Lock lock;
+    uint64 shared = 0;
+    PinnedThreads pool(threads, [&](usize) {
+      for(usize i = 0; i < round_items; i++) {
+        LockGuard guard(lock);
+        shared++;
+        clobber_memory();
+      }
+    });
+
+    state.set_items_per_op(threads * round_items);
+    state.run(std::string(name) + "/threads/" + std::to_string(threads), [&] { pool.run(); });
+    do_not_optimize(shared);
+  }
+}
+
+/// All threads on one lock, pinned to their own CPUs: acquisitions per
+/// second as contention grows.
+KTA_BENCHMARK("Locks/contended") {
+  for(const usize threads : thread_counts()) {
+    run_contended<SpinLock>(state, "spin", threads);
+    run_contended<TicketLock>(state, "ticket", threads);
+    run_contended<McsLock>(state, "mcs", threads);
+  }
+}
+
+/// Readers loading a snapshot while one writer keeps replacing it.
+/// Thread 0 writes until every reader has done its round_items loads.
+KTA_BENCHMARK("SeqLock/readers_with_writer") {
+  struct Quote { uint64 bid, ask, bid_size, ask_size; };
+
+  for(const usize threads : thread_counts(2)) {
+    SeqLock<Quote> lock;
+    Atomic<usize> finished{0};
+    const usize readers = threads - 1;
+
+    PinnedThreads pool(threads, [&](usize index) {
+      if(index == 0) {
+        for(uint64 next = 0; finished.load(MemoryOrder::Relaxed) != readers; next++) {
+          lock.store(Quote{next, next + 1, next + 2, next + 3});
+        }
+        return;
+      }
+
+      for(usize i = 0; i < round_items; i++) {
+        const Quote quote = lock.load();
+        do_not_optimize(quote);
+      }
+      finished.fetch_add(1, MemoryOrder::Relaxed);
+    });
+
+    state.set_items_per_op(readers * round_items);
+    state.run("readers/" + std::to_string(readers), [&] {
+      finished.store(0, MemoryOrder::Relaxed);
+      pool.run();
+    });
+  }
+}
+#  endif //defined(KTA_HAS_PTHREADS_)
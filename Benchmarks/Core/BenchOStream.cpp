@@ -0,0 +1,57 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/OStream.hpp>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  usize sunk_bytes = 0;
+
+  /// Stands in for a console or a file: just counts what it's given.
+  auto sink(StringView sv) -> void {
+    sunk_bytes += sv.size();
+    do_not_optimize(sv);
+  }
+}
+
+KTA_BENCHMARK("OStream/write_string") {
+  OStream<> stream(&sink);
+  const StringView line("the quick brown fox jumps over the lazy dog\n");
+  state.set_bytes_per_op(line.size());
+  state.run([&] {
+    stream.write(line);
+  });
+  stream.flush();
+}
+
+KTA_BENCHMARK("OStream/integers") {
+  OStream<> stream(&sink);
+  Rng rng;
+  uint64 values[64];
+  for(auto& value : values) value = rng.next() >> rng.below(64);
+
+  state.set_items_per_op(64);
+  state.run("dec", [&] {
+    for(const uint64 value : values) stream << value << ' ';
+  });
+
+  stream << kta::hex;
+  state.run("hex", [&] {
+    for(const uint64 value : values) stream << value << ' ';
+  });
+  stream << kta::dec << kta::flush;
+}
+
+KTA_BENCHMARK("OStream/mixed_line") {
+  OStream<> stream(&sink);
+  int64 counter = 0;
+  state.run([&] {
+    stream << StringView("request ") << counter++ << StringView(" took ") << uint32(1234) << StringView(" us") << kta::endl;
+  });
+}
@@ -0,0 +1,64 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Option.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  /// A 64 bit id where ~0 means "none", so its Option_ uses the niche.
+  struct Id {
+    uint64 bits = 0;
+  };
+}
+
+template<>
+struct kta::NicheTraits<Id> {
+  static constexpr bool has_niche = true;
+  NODISCARD_ FORCEINLINE_ static auto niche() -> Id { return Id{~0ull}; }
+  NODISCARD_ FORCEINLINE_ static auto is_niche(const Id& id) -> bool { return id.bits == ~0ull; }
+};
+
+namespace {
+  static_assert(sizeof(Option<Id>) == 8);
+  static_assert(sizeof(Option<uint64>) == 16);
+
+  /// Sums the present values of a mostly full array. Every fourth one
+  /// is empty, in a pattern the branch predictor learns, so what's left
+  /// is mostly the cost of streaming the array through.
+  template<typename O, typename Get>
+  auto bench_scan(State& state, const char* name, usize n, Get get) -> void {
+    std::vector<O> options(n);
+    Rng rng;
+    for(usize i = 0; i < n; i++) {
+      if(i % 4 != 3) options[i] = O(rng.next() >> 1);
+    }
+
+    state.set_bytes_per_op(n * sizeof(O));
+    state.set_items_per_op(n);
+    state.run(std::string(name) + "/" + std::to_string(n), [&] {
+      uint64 total = 0;
+      for(const O& option : options) {
+        if(option.has_value()) total += get(option.value());
+      }
+      do_not_optimize(total);
+    });
+  }
+}
+
+/// Same work on the same values; only the layout differs. The niche
+/// version is half the size, which shows once the array leaves cache.
+KTA_BENCHMARK("Option/scan") {
+  for(const usize n : {usize(4096), usize(1) << 20, usize(1) << 23}) {
+    bench_scan<Option<uint64>>(state, "flag", n, [](uint64 value) { return value; });
+    bench_scan<Option<Id>>(state, "niche", n, [](const Id& id) { return id.bits; });
+  }
+}
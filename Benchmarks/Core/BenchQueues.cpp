@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/SpscRing.hpp>
+#include <Kalantha/Core/MpmcQueue.hpp>
+#include <Kalantha/Core/WorkStealingDeque.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace kta;
+using namespace kta::bench;
+
+/*
+* single threaded round trips: a burst of pushes, then as many pops.
+* this is the per operation cost without any cache line ping-pong,
+* which the multithreaded benchmarks further down show.
+*/
+
+namespace {
+  constexpr usize burst = 256;
+  constexpr usize arena_size = 1 << 20;
+}
+
+KTA_BENCHMARK("SpscRing/push_pop") {
+  auto ring = std::make_unique<SpscRing<uint64, 1024>>();
+  state.set_items_per_op(burst);
+
+  state.run([&] {
+    for(usize i = 0; i < burst; i++) do_not_optimize(ring->try_push(i));
+    for(usize i = 0; i < burst; i++) {
+      auto value = ring->try_pop();
+      do_not_optimize(value);
+    }
+  });
+}
+
+KTA_BENCHMARK("MpmcQueue/push_pop") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+  MpmcQueue<uint64> queue(&arena);
+  if(!queue.init(1024).has_value()) return;
+  state.set_items_per_op(burst);
+
+  state.run([&] {
+    for(usize i = 0; i < burst; i++) do_not_optimize(queue.try_push(i));
+    for(usize i = 0; i < burst; i++) {
+      auto value = queue.try_pop();
+      do_not_optimize(value);
+    }
+  });
+}
+
+KTA_BENCHMARK("WorkStealingDeque") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+  WorkStealingDeque<uint64> deque(&arena);
+  if(!deque.init(1024).has_value()) return;
+  state.set_items_per_op(burst);
+
+  state.run("push_pop", [&] {
+    for(usize i = 0; i < burst; i++) do_not_optimize(deque.push(i));
+    for(usize i = 0; i < burst; i++) {
+      auto value = deque.pop();
+      do_not_optimize(value);
+    }
+  });
+
+  state.run("push_steal", [&] {
+    for(usize i = 0; i < burst; i++) do_not_optimize(deque.push(i));
+    for(usize i = 0; i < burst; i++) {
+      auto value = deque.steal();
+      do_not_optimize(value);
+    }
+  });
+}
+
+#  if defined(KTA_HAS_PTHREADS_)
+/*
+* the same queues between threads pinned to their own CPUs, where
+* there are enough. every op is one round of round_items items per
+* thread, see PinnedThreads.
+*/
+
+namespace {
+  constexpr usize round_items = 4096;
+}
+
+/// One item goes over and comes straight back on a second ring, so ns/op
+/// over round_items is the round trip latency between the two CPUs.
+KTA_BENCHMARK("SpscRing/ping_pong") {
+  auto there = std::make_unique<SpscRing<uint64, 1024>>();
+  auto back  = std::make_unique<SpscRing<uint64, 1024>>();
+  PinnedThreads threads(2, [&](usize index) {
+    for(uint64 i = 0; i < round_items; i++) {
+      if(index == 0) {
+        spin_until([&] { return there->try_push(i); });
+        spin_until([&] { return back->try_pop().has_value(); });
+      } else {
+        Option<uint64> value;
+        spin_until([&] { return (value = there->try_pop()).has_value(); });
+        spin_until([&] { return back->try_push(*value); });
+      }
+    }
+  });
+
+  state.set_items_per_op(round_items);
+  state.run([&] { threads.run(); });
+}
+
+/// One producer, one consumer, as fast as the ring lets them.
+KTA_BENCHMARK("SpscRing/throughput") {
+  auto ring = std::make_unique<SpscRing<uint64, 1024>>();
+  PinnedThreads threads(2, [&](usize index) {
+    for(uint64 i = 0; i < round_items; i++) {
+      if(index == 0) spin_until([&] { return ring->try_push(i); });
+      else spin_until([&] { return ring->try_pop().has_value(); });
+    }
+  });
+
+  state.set_items_per_op(round_items);
+  state.run([&] { threads.run(); });
+}
+
+/// Every thread is both a producer and a consumer: push one, pop one.
+/// Flat items/s as threads are added means the queue scales.
+KTA_BENCHMARK("MpmcQueue/scaling") {
+  for(const usize n : thread_counts()) {
+    auto buffer = std::make_unique<uint8[]>(arena_size);
+    BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+    MpmcQueue<uint64> queue(&arena);
+    if(!queue.init(1024).has_value()) return;
+
+    PinnedThreads threads(n, [&](usize) {
+      for(uint64 i = 0; i < round_items; i++) {
+        spin_until([&] { return queue.try_push(i); });
+        spin_until([&] { return queue.try_pop().has_value(); });
+      }
+    });
+
+    state.set_items_per_op(n * round_items);
+    state.run("threads/" + std::to_string(n), [&] { threads.run(); });
+  }
+}
+#  endif //defined(KTA_HAS_PTHREADS_)
@@ -0,0 +1,101 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Option.hpp>
+#include <Kalantha/Core/Try.hpp>
+#include <Kalantha/Core/Errors.hpp>
+
+using namespace kta;
+using namespace kta::bench;
+
+/*
+* the cost of carrying errors through a few call levels with TRY,
+* against plain integers with the error folded into the value. the
+* leaves are NOINLINE_ so each level is a real call, as it usually
+* is when the error comes from somewhere interesting.
+*/
+
+namespace {
+  NOINLINE_ auto leaf_result(uint64 value) -> Result<uint64, Error> {
+    if(value == ~0ull) return Error{"leaf failed", ErrC::InvalidArg};
+    return value + 1;
+  }
+
+  NOINLINE_ auto mid_result(uint64 value) -> Result<uint64, Error> {
+    const uint64 a = TRY(leaf_result(value));
+    const uint64 b = TRY(leaf_result(a));
+    return a + b;
+  }
+
+  NOINLINE_ auto top_result(uint64 value) -> Result<uint64, Error> {
+    const uint64 a = TRY(mid_result(value));
+    const uint64 b = TRY(mid_result(a));
+    return a ^ b;
+  }
+
+  NOINLINE_ auto leaf_option(uint64 value) -> Option<uint64> {
+    if(value == ~0ull) return {};
+    return value + 1;
+  }
+
+  NOINLINE_ auto top_option(uint64 value) -> Option<uint64> {
+    auto a = leaf_option(value);
+    if(!a.has_value()) return {};
+    auto b = leaf_option(a.value());
+    if(!b.has_value()) return {};
+    return a.value() + b.value();
+  }
+
+  NOINLINE_ auto leaf_plain(uint64 value) -> uint64 {
+    return value == ~0ull ? 0 : value + 1;
+  }
+
+  NOINLINE_ auto mid_plain(uint64 value) -> uint64 {
+    const uint64 a = leaf_plain(value);
+    if(a == 0) return 0;
+    const uint64 b = leaf_plain(a);
+    if(b == 0) return 0;
+    return a + b;
+  }
+
+  NOINLINE_ auto top_plain(uint64 value) -> uint64 {
+    const uint64 a = mid_plain(value);
+    if(a == 0) return 0;
+    const uint64 b = mid_plain(a);
+    if(b == 0) return 0;
+    return a ^ b;
+  }
+}
+
+KTA_BENCHMARK("Result/propagate") {
+  uint64 input = 1;
+
+  state.run("result_try", [&] {
+    do_not_optimize(input);
+    auto res = top_result(input);
+    do_not_optimize(res);
+  });
+
+  state.run("option", [&] {
+    do_not_optimize(input);
+    auto res = top_option(input);
+    do_not_optimize(res);
+  });
+
+  state.run("plain", [&] {
+    do_not_optimize(input);
+    do_not_optimize(top_plain(input));
+  });
+
+  input = ~0ull;
+  state.run("result_try_error", [&] {
+    do_not_optimize(input);
+    auto res = top_result(input);
+    do_not_optimize(res);
+  });
+}
@@ -0,0 +1,129 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/ParallelAlgorithm.hpp>
+#include <Kalantha/Core/Scheduler.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+#  if defined(KTA_HAS_PTHREADS_)
+namespace {
+  constexpr usize arena_size = 4 << 20;
+}
+
+/// Sequential against parallel over the same data, with one worker per CPU,
+/// from 1K elements up to --max-elements (1G at most), to find where the
+/// parallel versions start to win. Sorting copies the input first, so the
+/// copy is part of both rows. On a single CPU machine the parallel rows
+/// only show the scheduling overhead.
+KTA_BENCHMARK("ParallelAlgorithm") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+  Scheduler sched;
+  if(!sched.start(&arena, {}).has_value()) return;
+
+  for(usize shift = 10; shift <= 30; shift += 4) {
+    const usize n = usize(1) << shift;
+    if(n > state.max_elements()) break;
+
+    std::vector<uint32> values(n);
+    std::vector<uint32> sorted(n);
+    std::vector<uint64> scanned(n);
+    Rng rng;
+    for(auto& value : values) value = static_cast<uint32>(rng.next());
+
+    const Span<const uint32> in(values.data(), n);
+    state.set_bytes_per_op(n * sizeof(uint32));
+
+    state.run("reduce/seq/" + std::to_string(n), [&] {
+      do_not_optimize(kta::reduce(seq, in, uint64(0)));
+    });
+
+    state.run("reduce/par/" + std::to_string(n), [&] {
+      do_not_optimize(kta::reduce(par(sched), in, uint64(0)));
+    });
+
+    state.run("inclusive_scan/seq/" + std::to_string(n), [&] {
+      auto out = kta::inclusive_scan(seq, in, Span<uint64>(scanned.data(), n));
+      do_not_optimize(out);
+    });
+
+    state.run("inclusive_scan/par/" + std::to_string(n), [&] {
+      auto out = kta::inclusive_scan(par(sched), in, Span<uint64>(scanned.data(), n));
+      do_not_optimize(out);
+    });
+
+    state.run("sort/seq/" + std::to_string(n), [&] {
+      std::memcpy(sorted.data(), values.data(), n * sizeof(uint32));
+      kta::sort(seq, Span<uint32>(sorted.data(), n));
+    });
+
+    state.run("sort/par/" + std::to_string(n), [&] {
+      std::memcpy(sorted.data(), values.data(), n * sizeof(uint32));
+      kta::sort(par(sched), Span<uint32>(sorted.data(), n));
+    });
+  }
+
+  sched.stop();
+}
+
+KTA_BENCHMARK("Scheduler/parallel_for") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+  Scheduler sched;
+  if(!sched.start(&arena, {}).has_value()) return;
+
+  /// Tiny bodies, so this is mostly the cost of splitting and joining.
+  std::vector<uint64> values(65536);
+  state.set_items_per_op(values.size());
+  for(const usize grain : {usize(64), usize(1024), usize(16384)}) {
+    state.run("grain/" + std::to_string(grain), [&] {
+      parallel_for(sched, Span<uint64>(values.data(), values.size()), [](uint64& value) { value++; }, grain);
+    });
+  }
+
+  sched.stop();
+}
+
+/// An embarrassingly parallel loop, heavy enough per element that
+/// splitting is noise, on more and more threads. The calling thread
+/// helps out, so n threads is the caller plus n - 1 pinned workers;
+/// 1 thread is the plain sequential loop. Near-linear speedup shows
+/// up as items/s growing with the thread count.
+KTA_BENCHMARK("Scheduler/speedup") {
+  std::vector<uint64> values(1 << 20);
+  auto body = [](uint64& value) {
+    for(usize round = 0; round < 16; round++) {
+      value ^= value >> 31;
+      value *= 0x9E3779B97F4A7C15ull;
+    }
+  };
+
+  state.set_items_per_op(values.size());
+  for(const usize threads : thread_counts()) {
+    const Span<uint64> span(values.data(), values.size());
+    if(threads == 1) {
+      state.run("threads/1", [&] { for_each(seq, span, body); });
+      continue;
+    }
+
+    auto buffer = std::make_unique<uint8[]>(arena_size);
+    BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+    Scheduler sched;
+    if(!sched.start(&arena, {.workers = threads - 1, .pin_workers = true}).has_value()) return;
+    state.run("threads/" + std::to_string(threads), [&] { for_each(par(sched), span, body); });
+    sched.stop();
+  }
+}
+#  endif //defined(KTA_HAS_PTHREADS_)
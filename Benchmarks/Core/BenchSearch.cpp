@@ -0,0 +1,71 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Algorithm.hpp>
+#include <Kalantha/Core/Search.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  struct Table {
+    std::vector<uint32> sorted;
+    std::vector<uint32> layout;
+    std::vector<uint32> needles;
+  };
+
+  auto make_table(usize n) -> Table {
+    Rng rng;
+    Table table;
+    table.sorted.resize(n);
+    for(auto& key : table.sorted) key = static_cast<uint32>(rng.next());
+    kta::sort(Span<uint32>(table.sorted.data(), n));
+
+    table.layout.resize(n + 1);
+    eytzinger_build(Span<const uint32>(table.sorted.data(), n), Span<uint32>(table.layout.data(), n + 1));
+
+    table.needles.resize(256);
+    for(auto& needle : table.needles) needle = table.sorted[rng.below(n)];
+    return table;
+  }
+}
+
+/// The same lookups three ways, over tables from L1 sized to well past the L3.
+KTA_BENCHMARK("Search/lower_bound") {
+  for(const usize n : {usize(32), usize(1024), usize(65536), usize(1 << 22)}) {
+    const Table table = make_table(n);
+    const Span<const uint32> sorted(table.sorted.data(), n);
+    const Span<const uint32> layout(table.layout.data(), n + 1);
+    state.set_items_per_op(table.needles.size());
+
+    state.run("binary/" + std::to_string(n), [&] {
+      for(const uint32 needle : table.needles) {
+        usize index = lower_bound(sorted, needle);
+        do_not_optimize(index);
+      }
+    });
+
+    state.run("eytzinger/" + std::to_string(n), [&] {
+      for(const uint32 needle : table.needles) {
+        usize index = eytzinger_lower_bound(layout, needle);
+        do_not_optimize(index);
+      }
+    });
+
+    if(n <= 1024) {
+      state.run("linear/" + std::to_string(n), [&] {
+        for(const uint32 needle : table.needles) {
+          usize index = linear_lower_bound(sorted, needle);
+          do_not_optimize(index);
+        }
+      });
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/SmallVector.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#  if __has_include(<boost/container/small_vector.hpp>)
+#include <boost/container/small_vector.hpp>
+#define KTA_BENCH_HAS_BOOST_
+#  endif
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  constexpr usize arena_size = 16 << 20;
+}
+
+KTA_BENCHMARK("SmallVector/push_back") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  for(const usize n : {usize(8), usize(64), usize(65536)}) {
+    state.set_items_per_op(n);
+
+    /// 8 stays inline, the others spill into the arena and grow.
+    state.run(std::to_string(n), [&] {
+      BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+      SmallVector<uint64, 8> vec(&arena);
+      for(usize i = 0; i < n; i++) vec.push_back(i);
+      do_not_optimize(vec.data());
+    });
+
+    state.run("reserved/" + std::to_string(n), [&] {
+      BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+      SmallVector<uint64, 8> vec(&arena);
+      if(!vec.reserve(n).has_value()) return;
+      for(usize i = 0; i < n; i++) vec.push_back(i);
+      do_not_optimize(vec.data());
+    });
+
+    /// The same, against containers that allocate from the heap.
+    state.run("std_vector/" + std::to_string(n), [&] {
+      std::vector<uint64> vec;
+      for(usize i = 0; i < n; i++) vec.push_back(i);
+      do_not_optimize(vec.data());
+    });
+
+#  if defined(KTA_BENCH_HAS_BOOST_)
+    state.run("boost_small_vector/" + std::to_string(n), [&] {
+      boost::container::small_vector<uint64, 8> vec;
+      for(usize i = 0; i < n; i++) vec.push_back(i);
+      do_not_optimize(vec.data());
+    });
+#  endif //defined(KTA_BENCH_HAS_BOOST_)
+  }
+}
+
+KTA_BENCHMARK("SmallVector/iterate") {
+  auto buffer = std::make_unique<uint8[]>(arena_size);
+  BumpAllocator arena(buffer.get(), buffer.get() + arena_size);
+  SmallVector<uint64, 8> vec(&arena);
+  for(usize i = 0; i < 4096; i++) vec.push_back(i);
+
+  state.set_items_per_op(vec.size());
+  state.run([&] {
+    uint64 total = 0;
+    for(usize i = 0; i < vec.size(); i++) total += vec[i];
+    do_not_optimize(total);
+  });
+}
@@ -0,0 +1,38 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Stopwatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/TSC.hpp>
+#  endif
+
+using namespace kta;
+using namespace kta::bench;
+
+/// What a timestamp costs, i.e. how fine grained a region can be timed.
+KTA_BENCHMARK("Stopwatch/read") {
+  state.run("read_cycle_counter", [] { do_not_optimize(read_cycle_counter()); });
+
+#  if defined(ARCH_X86_64)
+  state.run("rdtsc", [] { do_not_optimize(x86_64::rdtsc()); });
+  state.run("rdtsc_ordered", [] { do_not_optimize(x86_64::rdtsc_ordered()); });
+  state.run("rdtscp", [] { do_not_optimize(x86_64::rdtscp()); });
+#  endif
+
+#  if defined(KTA_HAS_MONOTONIC_CLOCK_)
+  state.run("clock_gettime", [] { do_not_optimize(detail_::monotonic_ns_()); });
+#  endif
+}
+
+KTA_BENCHMARK("Stopwatch/cycles_to_ns") {
+  uint64 cycles = 123456789;
+  state.run([&] {
+    do_not_optimize(cycles);
+    do_not_optimize(cycles_to_ns(cycles));
+  });
+}
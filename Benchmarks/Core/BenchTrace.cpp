@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#define KTA_TRACING_ON_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Trace.hpp>
+
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  constexpr usize zones = 256;
+
+  NOINLINE_ auto traced_leaf(uint64& value) -> void {
+    KTA_TRACE_SCOPE("leaf");
+    value++;
+  }
+
+  NOINLINE_ auto untraced_leaf(uint64& value) -> void {
+    value++;
+  }
+}
+
+/// Per zone cost: "recording" is the number to hold under ~20ns. The
+/// other rows are the floor it sits on and the cost with no buffer.
+/// "recording" minus "two_timestamps" is what the bookkeeping adds.
+/// A zone reads the counter twice, so where one read costs more than
+/// about 8ns the target is out of reach whatever the bookkeeping does.
+/// That's the case on KVM guests that trap rdtsc: on one, a read took
+/// 21-24ns and a zone 45-50ns, with the bookkeeping within noise.
+KTA_BENCHMARK("Trace/zone") {
+  std::vector<TraceEvent> storage(zones);
+  TraceBuffer buffer(Span<TraceEvent>(storage.data(), zones));
+  uint64 value = 0;
+  state.set_items_per_op(zones);
+
+  state.run("baseline", [&] {
+    for(usize i = 0; i < zones; i++) untraced_leaf(value);
+    do_not_optimize(value);
+  });
+
+  state.run("no_buffer", [&] {
+    for(usize i = 0; i < zones; i++) traced_leaf(value);
+    do_not_optimize(value);
+  });
+
+  state.run("two_timestamps", [&] {
+    for(usize i = 0; i < zones; i++) {
+      const uint64 begin = read_cycle_counter();
+      untraced_leaf(value);
+      do_not_optimize(begin);
+      do_not_optimize(read_cycle_counter());
+    }
+  });
+
+  trace_attach_thread(buffer);
+  state.run("recording", [&] {
+    buffer.clear();
+    for(usize i = 0; i < zones; i++) traced_leaf(value);
+    do_not_optimize(value);
+  });
+
+  /// Full buffer: the drop path.
+  state.run("dropping", [&] {
+    for(usize i = 0; i < zones; i++) traced_leaf(value);
+    do_not_optimize(value);
+  });
+
+  trace_detach_buffer(buffer);
+}
+
+KTA_BENCHMARK("Trace/export") {
+  std::vector<TraceEvent> storage(4096);
+  TraceBuffer buffer(Span<TraceEvent>(storage.data(), storage.size()), "bench");
+  trace_attach_thread(buffer);
+  uint64 value = 0;
+  for(usize i = 0; i < storage.size(); i++) traced_leaf(value);
+  trace_detach_thread();
+
+  OStream<> out([](StringView text) { do_not_optimize(text.data()); });
+  state.set_items_per_op(storage.size());
+  state.run([&] { do_not_optimize(write_chrome_trace(out)); });
+
+  trace_detach_buffer(buffer);
+}
@@ -0,0 +1,77 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Core/Varint.hpp>
+
+#include <vector>
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  constexpr usize count = 4096;
+
+  /// Mostly small values with a long tail, like lengths and deltas tend to be.
+  auto make_values() -> std::vector<uint32> {
+    Rng rng;
+    std::vector<uint32> values(count);
+    for(auto& value : values) value = static_cast<uint32>(rng.next() >> (32 + rng.below(32)));
+    return values;
+  }
+}
+
+KTA_BENCHMARK("Varint/leb128") {
+  const auto values = make_values();
+  std::vector<uint8> encoded(count * max_varint_size<uint32>);
+  std::vector<uint32> decoded(count);
+  const usize size = encode_varints(Span<const uint32>(values.data(), count),
+                                    Span<uint8>(encoded.data(), encoded.size())).value();
+
+  state.set_items_per_op(count);
+  state.run("encode", [&] {
+    auto res = encode_varints(Span<const uint32>(values.data(), count), Span<uint8>(encoded.data(), encoded.size()));
+    do_not_optimize(res);
+  });
+
+  state.run("decode", [&] {
+    auto res = decode_varints(Span<const uint8>(encoded.data(), size), Span<uint32>(decoded.data(), count));
+    do_not_optimize(res);
+  });
+}
+
+KTA_BENCHMARK("Varint/streamvbyte") {
+  const auto values = make_values();
+  std::vector<uint8> encoded(streamvbyte_max_size(count));
+  std::vector<uint32> decoded(count);
+  const usize size = streamvbyte_encode(Span<const uint32>(values.data(), count),
+                                        Span<uint8>(encoded.data(), encoded.size())).value();
+
+  state.set_items_per_op(count);
+  state.run("encode", [&] {
+    auto res = streamvbyte_encode(Span<const uint32>(values.data(), count), Span<uint8>(encoded.data(), encoded.size()));
+    do_not_optimize(res);
+  });
+
+  state.run("decode", [&] {
+    auto res = streamvbyte_decode(Span<const uint8>(encoded.data(), size), Span<uint32>(decoded.data(), count));
+    do_not_optimize(res);
+  });
+}
+
+KTA_BENCHMARK("Varint/zigzag") {
+  int64 values[256];
+  Rng rng;
+  for(auto& value : values) value = static_cast<int64>(rng.next()) >> rng.below(64);
+
+  state.set_items_per_op(256);
+  state.run([&] {
+    for(const int64 value : values) {
+      uint64 encoded = zigzag_encode(value);
+      do_not_optimize(encoded);
+    }
+  });
+}
@@ -0,0 +1,352 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Stopwatch.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Core/Thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+BEGIN_NAMESPACE(kta::bench);
+
+/*
+* A small microbenchmark harness for kta_bench.
+*
+* a benchmark is a function taking a State, registered with
+* KTA_BENCHMARK("Group/name"). it sets up its inputs and hands the
+* code under test to state.run(), which:
+*  - calls it in batches of doubling size until a batch takes long
+*    enough to time reliably, which doubles as the warmup,
+*  - keeps warming up until the warmup time has passed,
+*  - times a fixed number of samples at that batch size.
+*
+* results are in nanoseconds and in cycles per call. cycles are ticks
+* of read_cycle_counter(), which is the TSC on x86-64: a constant
+* reference rate, not the core clock, so they don't follow turbo.
+* where the counter's rate isn't known, nanoseconds come from the
+* wall clock instead.
+*
+* the compiler sees through most benchmark loops. pass results to
+* do_not_optimize() and inputs that could be constant folded through
+* it too; clobber_memory() forces pending stores to be done.
+*/
+
+/// Makes the compiler assume value is read, and for non-const lvalues, changed.
+template<typename T>
+FORCEINLINE_ auto do_not_optimize(const T& value) -> void {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template<typename T>
+FORCEINLINE_ auto do_not_optimize(T& value) -> void {
+#  if KTA_CLANG
+  asm volatile("" : "+r,m"(value) : : "memory");
+#  else
+  asm volatile("" : "+m,r"(value) : : "memory");
+#  endif
+}
+
+/// Makes the compiler assume all memory is read and written.
+FORCEINLINE_ auto clobber_memory() -> void {
+  asm volatile("" : : : "memory");
+}
+
+/// SplitMix64. Deterministic inputs, so runs are comparable.
+class Rng {
+public:
+  auto next() -> uint64 {
+    uint64 z = (state_ += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  /// Uniform enough in [0, bound) for bench inputs.
+  auto below(uint64 bound) -> uint64 { return next() % bound; }
+
+  explicit Rng(uint64 seed = 42) : state_(seed) {}
+private:
+  uint64 state_ = 0;
+};
+
+struct Config {
+  std::string filter;              /// Only run benchmarks whose name contains this.
+  uint64 min_sample_ns = 5'000'000;
+  uint64 warmup_ns     = 10'000'000;
+  usize  samples       = 10;
+  usize  max_elements  = usize(1) << 26; /// Size sweeps skip anything bigger.
+  bool   list_only     = false;
+};
+
+struct Measurement {
+  std::string name;
+  uint64 iterations    = 0; /// Calls per sample.
+  double ns_per_op     = 0; /// Median over the samples.
+  double ns_min        = 0; /// Fastest sample.
+  double cycles_per_op = 0; /// Median over the samples.
+  usize  bytes_per_op  = 0;
+  usize  items_per_op  = 0;
+
+  NODISCARD_ auto bytes_per_second() const -> double {
+    return ns_per_op > 0 ? static_cast<double>(bytes_per_op) * 1e9 / ns_per_op : 0;
+  }
+
+  NODISCARD_ auto items_per_second() const -> double {
+    return ns_per_op > 0 ? static_cast<double>(items_per_op) * 1e9 / ns_per_op : 0;
+  }
+};
+
+class State {
+public:
+  /// Bytes (items) one call processes, for throughput. Applies to every
+  /// run() after it.
+  auto set_bytes_per_op(usize bytes) -> void { bytes_per_op_ = bytes; }
+  auto set_items_per_op(usize items) -> void { items_per_op_ = items; }
+
+  /// The largest input a size sweep should build, from --max-elements.
+  NODISCARD_ auto max_elements() const -> usize { return config_.max_elements; }
+
+  /// Measures fn, reported under the benchmark's name.
+  template<typename Fn>
+  auto run(Fn&& fn) -> void {
+    measure_(name_, fn);
+  }
+
+  /// Measures fn, reported as "<benchmark name>/<variant>".
+  template<typename Fn>
+  auto run(const std::string& variant, Fn&& fn) -> void {
+    measure_(name_ + "/" + variant, fn);
+  }
+
+  State(const char* name, const Config& config, std::vector<Measurement>& out)
+    : name_(name), config_(config), out_(out) {}
+private:
+  struct BatchTime_ {
+    uint64 cycles = 0;
+    uint64 ns     = 0;
+  };
+
+  /// Batches never grow past this, even if the clocks say they take no time.
+  static constexpr uint64 max_batch_ = uint64(1) << 32;
+
+  template<typename Fn>
+  NOINLINE_ static auto time_batch_(Fn& fn, uint64 iterations) -> BatchTime_ {
+    const auto wall_begin = std::chrono::steady_clock::now();
+    const uint64 begin = read_cycle_counter();
+    for(uint64 i = 0; i < iterations; i++) {
+      fn();
+      clobber_memory();
+    }
+
+    const uint64 cycles = read_cycle_counter() - begin;
+    const auto wall = std::chrono::steady_clock::now() - wall_begin;
+    const uint64 ns = cycle_counter_frequency() != 0
+      ? cycles_to_ns(cycles)
+      : static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(wall).count());
+    return BatchTime_{cycles, ns};
+  }
+
+  template<typename Fn>
+  auto measure_(const std::string& name, Fn& fn) -> void;
+
+  std::string name_;
+  const Config& config_;
+  std::vector<Measurement>& out_;
+  usize bytes_per_op_ = 0;
+  usize items_per_op_ = 0;
+};
+
+#  if defined(KTA_HAS_PTHREADS_)
+/*
+* Threads for the multithreaded benchmarks.
+*
+* a PinnedThreads keeps its threads alive for the whole benchmark,
+* thread i pinned to CPU i modulo the CPU count. the calling thread is
+* thread 0, pinned to CPU 0 until the PinnedThreads goes away. run()
+* has every thread call body(index) once and returns when all of them
+* have, so timing run() times one round of the workload, plus a
+* wakeup and a join that the round should be long enough to hide.
+*
+* waiting threads spin for a bit and then yield, so asking for more
+* threads than there are CPUs works, it just measures the OS scheduler.
+*/
+class PinnedThreads {
+public:
+  using Body = std::function<void(usize)>;
+
+  auto run() -> void {
+    done_.store(0, MemoryOrder::Relaxed);
+    round_.fetch_add(1, MemoryOrder::Release);
+    body_(0);
+
+    Backoff backoff;
+    while(done_.load(MemoryOrder::Acquire) != helpers_.size()) backoff.spin();
+  }
+
+  NODISCARD_ auto size() const -> usize { return helpers_.size() + 1; }
+
+  PinnedThreads(usize count, Body body) : body_(kta::move(body)) {
+#    if defined(KTA_HAS_AFFINITY_)
+    ::pthread_getaffinity_np(::pthread_self(), sizeof(caller_affinity_), &caller_affinity_);
+#    endif
+    pin_(0);
+    for(usize i = 1; i < count; i++) helpers_.emplace_back([this, i] { helper_main_(i); });
+  }
+
+  ~PinnedThreads() {
+    stop_.store(true, MemoryOrder::Relaxed);
+    round_.fetch_add(1, MemoryOrder::Release);
+    for(auto& thread : helpers_) thread.join();
+#    if defined(KTA_HAS_AFFINITY_)
+    ::pthread_setaffinity_np(::pthread_self(), sizeof(caller_affinity_), &caller_affinity_);
+#    endif
+  }
+
+  PinnedThreads(const PinnedThreads&) = delete;
+  auto operator=(const PinnedThreads&) -> PinnedThreads& = delete;
+private:
+  static auto pin_(usize index) -> void {
+    const ThreadPlatform platform = default_thread_platform();
+    const usize cpus = platform.cpu_count();
+    if(platform.pin_current != nullptr && cpus != 0) platform.pin_current(index % cpus);
+  }
+
+  auto helper_main_(usize index) -> void {
+    pin_(index);
+    uint64 seen = 0;
+    for(;;) {
+      Backoff backoff;
+      uint64 round = 0;
+      while((round = round_.load(MemoryOrder::Acquire)) == seen) backoff.spin();
+      if(stop_.load(MemoryOrder::Relaxed)) return;
+
+      seen = round;
+      body_(index);
+      done_.fetch_add(1, MemoryOrder::Release);
+    }
+  }
+
+  Body body_;
+  std::vector<std::thread> helpers_;
+  alignas(cache_line_size) Atomic<uint64> round_{0};
+  alignas(cache_line_size) Atomic<usize> done_{0};
+  Atomic<bool> stop_{false};
+#    if defined(KTA_HAS_AFFINITY_)
+  cpu_set_t caller_affinity_{};
+#    endif
+};
+
+/// Spins until pred() holds. Yields now and then, so threads sharing a CPU get to run.
+template<typename Pred>
+FORCEINLINE_ auto spin_until(Pred&& pred) -> void {
+  for(uint32 spins = 1; !pred(); spins++) {
+    if(spins % 256 == 0) thread_yield();
+    else cpu_relax();
+  }
+}
+
+/// CPUs to spread threads over, at least 1.
+NODISCARD_ inline auto cpu_count() -> usize {
+  const usize cpus = default_thread_platform().cpu_count();
+  return cpus != 0 ? cpus : 1;
+}
+
+/// Thread counts for a scaling sweep: powers of two from first up to
+/// the CPU count, and the CPU count itself. Just first on smaller machines.
+NODISCARD_ inline auto thread_counts(usize first = 1) -> std::vector<usize> {
+  const usize cpus = cpu_count();
+  std::vector<usize> counts;
+  for(usize n = first; n < cpus; n *= 2) counts.push_back(n);
+  if(counts.empty() || counts.back() != cpus) counts.push_back(cpus > first ? cpus : first);
+  return counts;
+}
+#  endif //defined(KTA_HAS_PTHREADS_)
+
+using BenchmarkFn = void(*)(State&);
+
+struct Benchmark {
+  const char* name = nullptr;
+  BenchmarkFn fn = nullptr;
+};
+
+NODISCARD_ inline auto registry() -> std::vector<Benchmark>& {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+struct Registrar_ {
+  Registrar_(const char* name, BenchmarkFn fn) {
+    registry().push_back(Benchmark{name, fn});
+  }
+};
+
+NODISCARD_ inline auto matches_filter(const std::string& name, const Config& config) -> bool {
+  return config.filter.empty() || name.find(config.filter) != std::string::npos;
+}
+
+template<typename Fn>
+auto State::measure_(const std::string& name, Fn& fn) -> void {
+  if(!matches_filter(name, config_)) return;
+  if(config_.list_only) {
+    out_.push_back(Measurement{.name = name});
+    return;
+  }
+
+  /// Find a batch size that takes at least min_sample_ns.
+  uint64 iterations = 1;
+  uint64 warmed_ns  = 0;
+  for(;;) {
+    const uint64 ns = time_batch_(fn, iterations).ns;
+    warmed_ns += ns;
+    if(ns >= config_.min_sample_ns || iterations >= max_batch_) break;
+
+    const uint64 scale = ns != 0 ? (config_.min_sample_ns * 5 / 4) / ns : 16;
+    iterations *= scale < 2 ? 2 : (scale > 16 ? 16 : scale);
+    if(iterations > max_batch_) iterations = max_batch_;
+  }
+
+  for(usize batches = 0; warmed_ns < config_.warmup_ns && batches < 64; batches++) {
+    warmed_ns += time_batch_(fn, iterations).ns;
+  }
+
+  std::vector<BatchTime_> samples(config_.samples != 0 ? config_.samples : 1);
+  for(auto& sample : samples) sample = time_batch_(fn, iterations);
+  std::sort(samples.begin(), samples.end(), [](const BatchTime_& a, const BatchTime_& b) { return a.ns < b.ns; });
+
+  const BatchTime_& median = samples[samples.size() / 2];
+  Measurement m;
+  m.name          = name;
+  m.iterations    = iterations;
+  m.cycles_per_op = static_cast<double>(median.cycles) / static_cast<double>(iterations);
+  m.ns_per_op     = static_cast<double>(median.ns) / static_cast<double>(iterations);
+  m.ns_min        = static_cast<double>(samples.front().ns) / static_cast<double>(iterations);
+  m.bytes_per_op  = bytes_per_op_;
+  m.items_per_op  = items_per_op_;
+  out_.push_back(m);
+}
+
+END_NAMESPACE(kta::bench);
+
+#define KTA_BENCH_CONCAT_IMPL_(A, B) A##B
+#define KTA_BENCH_CONCAT_(A, B) KTA_BENCH_CONCAT_IMPL_(A, B)
+
+#define KTA_BENCHMARK_IMPL_(NAME, FN)                                        \
+  static auto FN(::kta::bench::State& state) -> void;                        \
+  static const ::kta::bench::Registrar_ KTA_BENCH_CONCAT_(FN, _registrar_){  \
+    NAME, &FN                                                                \
+  };                                                                         \
+  static auto FN(UNUSED_ ::kta::bench::State& state) -> void
+
+/// Defines and registers a benchmark: KTA_BENCHMARK("Group/name") { ... }
+#define KTA_BENCHMARK(NAME) KTA_BENCHMARK_IMPL_(NAME, KTA_BENCH_CONCAT_(kta_benchmark_, __LINE__))
@@ -0,0 +1,186 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <Benchmarks/Harness.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/*
+* kta_bench [--filter=SUBSTR] [--format=console|csv|json] [--sample-ms=N]
+*           [--warmup-ms=N] [--samples=N] [--max-elements=N]
+*           [--simd-tier=scalar|sse4.2|avx2|avx512] [--list]
+*
+* runs every registered benchmark whose name contains the filter and
+* prints the results to stdout. console and csv rows are printed as
+* they come in, json once everything has run.
+*
+* size sweeps stop at --max-elements, 2^26 by default. the biggest
+* sizes take gigabytes, so going up to 2^30 needs a big machine.
+*/
+
+using namespace kta;
+using namespace kta::bench;
+
+namespace {
+  enum class Format { Console, Csv, Json };
+
+  struct Options {
+    Config config;
+    Format format = Format::Console;
+    SimdTier tier = SimdTier::Avx512;
+  };
+
+  auto usage() -> void {
+    std::fprintf(stderr,
+      "usage: kta_bench [--filter=SUBSTR] [--format=console|csv|json] [--sample-ms=N]\n"
+      "                 [--warmup-ms=N] [--samples=N] [--max-elements=N]\n"
+      "                 [--simd-tier=scalar|sse4.2|avx2|avx512] [--list]\n");
+  }
+
+  auto value_of(const char* arg, const char* flag) -> const char* {
+    const usize len = std::strlen(flag);
+    if(std::strncmp(arg, flag, len) == 0 && arg[len] == '=') return arg + len + 1;
+    return nullptr;
+  }
+
+  auto parse_args(int argc, char** argv, Options& opts) -> bool {
+    for(int i = 1; i < argc; i++) {
+      const char* arg = argv[i];
+      const char* val = nullptr;
+
+      if(std::strcmp(arg, "--list") == 0) {
+        opts.config.list_only = true;
+      } else if((val = value_of(arg, "--filter"))) {
+        opts.config.filter = val;
+      } else if((val = value_of(arg, "--sample-ms"))) {
+        opts.config.min_sample_ns = std::strtoull(val, nullptr, 10) * 1'000'000;
+      } else if((val = value_of(arg, "--warmup-ms"))) {
+        opts.config.warmup_ns = std::strtoull(val, nullptr, 10) * 1'000'000;
+      } else if((val = value_of(arg, "--samples"))) {
+        opts.config.samples = std::strtoull(val, nullptr, 10);
+      } else if((val = value_of(arg, "--max-elements"))) {
+        opts.config.max_elements = std::strtoull(val, nullptr, 10);
+      } else if((val = value_of(arg, "--format"))) {
+        if(std::strcmp(val, "console") == 0) opts.format = Format::Console;
+        else if(std::strcmp(val, "csv") == 0) opts.format = Format::Csv;
+        else if(std::strcmp(val, "json") == 0) opts.format = Format::Json;
+        else return false;
+      } else if((val = value_of(arg, "--simd-tier"))) {
+        bool found = false;
+        for(usize t = 0; t < simd_tier_count; t++) {
+          if(std::strcmp(val, simd_tier_to_string(static_cast<SimdTier>(t))) == 0) {
+            opts.tier = static_cast<SimdTier>(t);
+            found = true;
+          }
+        }
+        if(!found) return false;
+      } else {
+        return false;
+      }
+    }
+
+    if(opts.config.samples == 0) opts.config.samples = 1;
+    return true;
+  }
+
+  /// Prints a rate with an SI prefix, e.g. "1.23 G".
+  auto format_rate(double value, char* buff, usize size) -> void {
+    const char* prefixes[] = {"", "k", "M", "G", "T"};
+    usize p = 0;
+    while(value >= 1000.0 && p + 1 < sizeof(prefixes) / sizeof(prefixes[0])) {
+      value /= 1000.0;
+      p++;
+    }
+    std::snprintf(buff, size, "%.2f %s", value, prefixes[p]);
+  }
+
+  constexpr int name_width = 56;
+
+  auto print_console_header() -> void {
+    std::printf("%-*s %12s %12s %12s %12s %16s\n", name_width,
+      "benchmark", "ns/op", "min ns/op", "cycles/op", "iterations", "throughput");
+  }
+
+  auto print_console_row(const Measurement& m) -> void {
+    char rate[64] = "";
+    char scaled[32];
+    if(m.bytes_per_op != 0) {
+      format_rate(m.bytes_per_second(), scaled, sizeof(scaled));
+      std::snprintf(rate, sizeof(rate), "%sB/s", scaled);
+    } else if(m.items_per_op != 0) {
+      format_rate(m.items_per_second(), scaled, sizeof(scaled));
+      std::snprintf(rate, sizeof(rate), "%sitems/s", scaled);
+    }
+
+    std::printf("%-*s %12.2f %12.2f %12.1f %12llu %16s\n", name_width, m.name.c_str(),
+      m.ns_per_op, m.ns_min, m.cycles_per_op, static_cast<unsigned long long>(m.iterations), rate);
+  }
+
+  auto print_csv_header() -> void {
+    std::printf("name,iterations,ns_per_op,ns_min,cycles_per_op,bytes_per_second,items_per_second\n");
+  }
+
+  auto print_csv_row(const Measurement& m) -> void {
+    std::printf("\"%s\",%llu,%.3f,%.3f,%.2f,%.0f,%.0f\n", m.name.c_str(),
+      static_cast<unsigned long long>(m.iterations), m.ns_per_op, m.ns_min,
+      m.cycles_per_op, m.bytes_per_second(), m.items_per_second());
+  }
+
+  auto print_json(const std::vector<Measurement>& results) -> void {
+    std::printf("{\n  \"context\": {\"cycle_counter_hz\": %llu, \"simd_tier\": \"%s\"},\n  \"benchmarks\": [",
+      static_cast<unsigned long long>(cycle_counter_frequency()), simd_tier_to_string(simd_tier()));
+
+    for(usize i = 0; i < results.size(); i++) {
+      const auto& m = results[i];
+      std::printf("%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"ns_min\": %.3f, "
+        "\"cycles_per_op\": %.2f, \"bytes_per_second\": %.0f, \"items_per_second\": %.0f}",
+        i == 0 ? "" : ",", m.name.c_str(), static_cast<unsigned long long>(m.iterations),
+        m.ns_per_op, m.ns_min, m.cycles_per_op, m.bytes_per_second(), m.items_per_second());
+    }
+    std::printf("\n  ]\n}\n");
+  }
+}
+
+auto main(int argc, char** argv) -> int {
+  Options opts;
+  if(!parse_args(argc, argv, opts)) {
+    usage();
+    return 1;
+  }
+
+  set_simd_tier_limit(opts.tier);
+  if(!opts.config.list_only) {
+    if(opts.format == Format::Console) {
+      std::printf("cycle counter: %.3f GHz, simd tier: %s\n\n",
+        static_cast<double>(cycle_counter_frequency()) / 1e9, simd_tier_to_string(simd_tier()));
+      print_console_header();
+    } else if(opts.format == Format::Csv) {
+      print_csv_header();
+    }
+  }
+
+  std::vector<Measurement> results;
+  for(const auto& benchmark : registry()) {
+    const usize first = results.size();
+    State state(benchmark.name, opts.config, results);
+    benchmark.fn(state);
+
+    for(usize i = first; i < results.size(); i++) {
+      if(opts.config.list_only) std::printf("%s\n", results[i].name.c_str());
+      else if(opts.format == Format::Console) print_console_row(results[i]);
+      else if(opts.format == Format::Csv) print_csv_row(results[i]);
+    }
+    std::fflush(stdout);
+  }
+
+  if(!opts.config.list_only && opts.format == Format::Json) print_json(results);
+  return 0;
+}
@@ -0,0 +1,160 @@
+# Optimization profiles, -march selection, LTO and PGO.
+#
+# everything is attached to one INTERFACE target that the Kta* libraries
+# link, so a project consuming KtaCore through add_subdirectory() builds
+# the headers with the same flags as our own tests and benchmarks.
+#
+# PGO workflow (GCC or Clang):
+#   cmake -B build -DCMAKE_BUILD_TYPE=Release -DKTA_PGO=GENERATE
+#   cmake --build build --target kta_pgo_train
+#   cmake -B build -DKTA_PGO=USE
+#   cmake --build build
+# profiles land in KTA_PGO_DIR. with Clang, the .profraw files are merged
+# into kta.profdata when configuring with KTA_PGO=USE.
+
+set(KTA_BUILD_TYPES Debug Release RelWithDebInfo MinSizeRel)
+
+macro(kta_set_default_build_type type)
+  get_property(_kta_multi_config GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)
+  if(NOT _kta_multi_config AND NOT CMAKE_BUILD_TYPE)
+    message(STATUS "No build type given -- defaulting to ${type}")
+    set(CMAKE_BUILD_TYPE ${type} CACHE STRING "Build type" FORCE)
+  endif()
+  if(NOT _kta_multi_config)
+    set_property(CACHE CMAKE_BUILD_TYPE PROPERTY STRINGS ${KTA_BUILD_TYPES})
+  endif()
+endmacro()
+
+function(kta_target_optimization_profiles target)
+  set(gnu_like "$<OR:$<CXX_COMPILER_ID:GNU>,$<CXX_COMPILER_ID:Clang>>")
+  target_compile_options(${target} INTERFACE
+    $<$<AND:${gnu_like},$<CONFIG:Release>>:-O3>
+    $<$<AND:${gnu_like},$<CONFIG:RelWithDebInfo>>:-O2 -g>
+    $<$<AND:${gnu_like},$<CONFIG:MinSizeRel>>:-Os>
+    $<$<AND:$<CXX_COMPILER_ID:MSVC>,$<CONFIG:Release,RelWithDebInfo>>:/O2>
+  )
+endfunction()
+
+# KTA_MARCH is passed as-is: -march=<value> on GCC/Clang (native,
+# x86-64-v3, armv8.2-a, ...), /arch:<value> on MSVC (AVX2, AVX512).
+# the SIMD kernels still pick their variant at runtime, this only
+# raises the baseline the rest of the code is compiled for.
+function(kta_target_march target)
+  if(NOT KTA_MARCH)
+    return()
+  endif()
+
+  if(MSVC)
+    target_compile_options(${target} INTERFACE /arch:${KTA_MARCH})
+  else()
+    # keyed on the value: the check is cached, and KTA_MARCH can change between runs.
+    include(CheckCXXCompilerFlag)
+    string(MAKE_C_IDENTIFIER "KTA_MARCH_OK_${KTA_MARCH}" march_ok)
+    check_cxx_compiler_flag(-march=${KTA_MARCH} ${march_ok})
+    if(NOT ${march_ok})
+      message(FATAL_ERROR "Compiler doesn't accept -march=${KTA_MARCH}")
+    endif()
+    target_compile_options(${target} INTERFACE -march=${KTA_MARCH})
+  endif()
+  message(STATUS "Target architecture flags: ${KTA_MARCH}")
+endfunction()
+
+# flags rather than INTERPROCEDURAL_OPTIMIZATION: a target property
+# doesn't travel through INTERFACE linkage, compile and link options do.
+function(kta_target_lto target)
+  if(NOT KTA_ENABLE_LTO)
+    return()
+  endif()
+
+  include(CheckIPOSupported)
+  check_ipo_supported(RESULT _kta_ipo_ok OUTPUT _kta_ipo_error LANGUAGES CXX)
+  if(NOT _kta_ipo_ok)
+    message(FATAL_ERROR "LTO requested but not supported: ${_kta_ipo_error}")
+  endif()
+
+  if(MSVC)
+    target_compile_options(${target} INTERFACE /GL)
+    target_link_options(${target} INTERFACE /LTCG)
+  elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    target_compile_options(${target} INTERFACE -flto=thin)
+    target_link_options(${target} INTERFACE -flto=thin)
+  else()
+    target_compile_options(${target} INTERFACE -flto=auto)
+    target_link_options(${target} INTERFACE -flto=auto)
+  endif()
+  message(STATUS "Link time optimization enabled")
+endfunction()
+
+function(kta_merge_clang_profiles out_file)
+  get_filename_component(compiler_dir ${CMAKE_CXX_COMPILER} DIRECTORY)
+  find_program(KTA_LLVM_PROFDATA NAMES llvm-profdata HINTS ${compiler_dir})
+  if(NOT KTA_LLVM_PROFDATA)
+    message(FATAL_ERROR "KTA_PGO=USE with Clang needs llvm-profdata to merge the profiles")
+  endif()
+
+  file(GLOB _kta_raw_profiles "${KTA_PGO_DIR}/*.profraw")
+  if(NOT _kta_raw_profiles)
+    return()
+  endif()
+
+  execute_process(
+    COMMAND ${KTA_LLVM_PROFDATA} merge -o ${out_file} ${_kta_raw_profiles}
+    RESULT_VARIABLE _kta_merge_result
+  )
+  if(NOT _kta_merge_result EQUAL 0)
+    message(FATAL_ERROR "llvm-profdata failed to merge the profiles in ${KTA_PGO_DIR}")
+  endif()
+endfunction()
+
+function(kta_target_pgo target)
+  if(NOT KTA_PGO OR KTA_PGO STREQUAL "OFF")
+    return()
+  endif()
+  if(NOT KTA_PGO MATCHES "^(GENERATE|USE)$")
+    message(FATAL_ERROR "KTA_PGO must be OFF, GENERATE or USE, not ${KTA_PGO}")
+  endif()
+  if(NOT (CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang") OR MSVC)
+    message(FATAL_ERROR "PGO is only wired up for GCC and Clang")
+  endif()
+
+  set(is_clang OFF)
+  if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    set(is_clang ON)
+  endif()
+
+  if(KTA_PGO STREQUAL "GENERATE")
+    file(MAKE_DIRECTORY ${KTA_PGO_DIR})
+    set(flags -fprofile-generate=${KTA_PGO_DIR})
+    # the scheduler runs instrumented code on several threads at once.
+    if(NOT is_clang)
+      list(APPEND flags -fprofile-update=atomic)
+    endif()
+    target_compile_options(${target} INTERFACE ${flags})
+    target_link_options(${target} INTERFACE ${flags})
+  else()
+    if(is_clang)
+      set(profile "${KTA_PGO_DIR}/kta.profdata")
+      kta_merge_clang_profiles(${profile})
+      if(NOT EXISTS ${profile})
+        message(FATAL_ERROR "KTA_PGO=USE but there are no profiles in ${KTA_PGO_DIR}, run kta_pgo_train first")
+      endif()
+      target_compile_options(${target} INTERFACE -fprofile-use=${profile} -Wno-profile-instr-unprofiled)
+    else()
+      # code the training run never reached keeps its normal optimization
+      # instead of being treated as cold.
+      target_compile_options(${target} INTERFACE
+        -fprofile-use=${KTA_PGO_DIR}
+        -fprofile-partial-training
+        -Wno-missing-profile
+      )
+    endif()
+  endif()
+  message(STATUS "Profile guided optimization: ${KTA_PGO} (${KTA_PGO_DIR})")
+endfunction()
+
+function(kta_configure_build_options target)
+  kta_target_optimization_profiles(${target})
+  kta_target_march(${target})
+  kta_target_lto(${target})
+  kta_target_pgo(${target})
+endfunction()
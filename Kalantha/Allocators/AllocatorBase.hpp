@@ -28,6 +28,24 @@ public:
     return self.template allocate_<T>(kta::forward<Args>(args)...);
   }
 
+  FORCEINLINE_ auto allocate_bytes(this auto&& self, usize align, usize size) -> void* {
+    return self.allocate_bytes_(align, size);
+  }
+
+  FORCEINLINE_ auto deallocate_bytes(this auto&& self, void* ptr, usize size) -> __Result<void> {
+    return self.deallocate_bytes_(ptr, size);
+  }
+
+  /// Grows the block at ptr to new_size bytes without moving it.
+  /// Allocators that can't do this in place just report false.
+  FORCEINLINE_ auto extend_bytes(this auto&& self, void* ptr, usize size, usize new_size) -> bool {
+    if constexpr(requires { self.extend_bytes_(ptr, size, new_size); }) {
+      return self.extend_bytes_(ptr, size, new_size);
+    } else {
+      return false;
+    }
+  }
+
   FORCEINLINE_ auto remaining(this auto&& self) -> usize {
     return self.remaining_();
   }
@@ -0,0 +1,72 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Allocators/AllocatorBase.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Non-owning, type-erased handle to some other allocator.
+* for code that needs to hold on to an allocator without
+* becoming a template over its type. only the byte-level
+* interface is forwarded.
+*/
+
+class AllocatorRef : public AllocatorBase {
+public:
+  auto allocate_bytes_(usize align, usize size) -> void* {
+    if(impl_ == nullptr) return nullptr;
+    return allocate_fn_(impl_, align, size);
+  }
+
+  auto deallocate_bytes_(void* ptr, usize size) -> Result<void, Error> {
+    if(impl_ == nullptr) return Error(ErrC::InvalidArg);
+    return deallocate_fn_(impl_, ptr, size);
+  }
+
+  auto extend_bytes_(void* ptr, usize size, usize new_size) -> bool {
+    if(impl_ == nullptr) return false;
+    return extend_fn_(impl_, ptr, size, new_size);
+  }
+
+  auto remaining_() -> usize {
+    if(impl_ == nullptr) return 0;
+    return remaining_fn_(impl_);
+  }
+
+  NODISCARD_ auto is_valid() const -> bool { return impl_ != nullptr; }
+
+  template<typename Alloc>
+  explicit AllocatorRef(Alloc* alloc)
+    : impl_(alloc),
+      allocate_fn_([](void* a, usize align, usize size) -> void* {
+        return static_cast<Alloc*>(a)->allocate_bytes(align, size);
+      }),
+      deallocate_fn_([](void* a, void* ptr, usize size) -> Result<void, Error> {
+        return static_cast<Alloc*>(a)->deallocate_bytes(ptr, size);
+      }),
+      extend_fn_([](void* a, void* ptr, usize size, usize new_size) -> bool {
+        return static_cast<Alloc*>(a)->extend_bytes(ptr, size, new_size);
+      }),
+      remaining_fn_([](void* a) -> usize {
+        return static_cast<Alloc*>(a)->remaining();
+      }) {}
+
+  AllocatorRef() = default;
+private:
+  void* impl_ = nullptr;
+  void* (*allocate_fn_)(void*, usize, usize) = nullptr;
+  Result<void, Error> (*deallocate_fn_)(void*, void*, usize) = nullptr;
+  bool (*extend_fn_)(void*, void*, usize, usize) = nullptr;
+  usize (*remaining_fn_)(void*) = nullptr;
+};
+
+END_NAMESPACE_KTA_
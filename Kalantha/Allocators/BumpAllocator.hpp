@@ -33,6 +33,37 @@ public:
     return kta::construct_at<T>(ptr, kta::forward<Args>(args)...);
   }
 
+  FORCEINLINE_ auto allocate_bytes_(usize align, usize size) -> void* {
+    return allocate_block(align, size);
+  }
+
+  /// Only the most recent block can be handed back, anything
+  /// else stays reserved until the allocator itself goes away.
+  auto deallocate_bytes_(void* ptr, usize size) -> Result<void, Error> {
+    auto cur = reinterpret_cast<uintptr>(cur_);
+    auto blk = reinterpret_cast<uintptr>(ptr);
+    if(ptr == nullptr || !is_within_range(ptr) || blk + size != cur)
+      return Error(ErrC::NotImplemented);
+
+    cur_ = ptr;
+    return Result<void, Error>::create();
+  }
+
+  /// Same restriction: only the most recent block can grow, into
+  /// whatever is left between it and the end of the arena.
+  auto extend_bytes_(void* ptr, usize size, usize new_size) -> bool {
+    auto cur = reinterpret_cast<uintptr>(cur_);
+    auto blk = reinterpret_cast<uintptr>(ptr);
+    auto end = reinterpret_cast<uintptr>(end_);
+    if(ptr == nullptr || !is_within_range(ptr) || blk + size != cur)
+      return false;
+    if(new_size < size || new_size - size > end - cur)
+      return false;
+
+    cur_ = reinterpret_cast<void*>(blk + new_size);
+    return true;
+  }
+
   NODISCARD_ FORCEINLINE_ auto is_valid() const -> bool {
     const bool is_nonnull = beg_ && cur_ && end_;
     const bool rangecheck = end_ >= beg_;
@@ -0,0 +1,190 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Locks.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/CPUID.hpp>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Cache sizes and core/SMT layout, for sizing buffers and work splits.
+*
+* a default constructed CpuTopology holds conservative values that fit
+* anything we target, so it can be used as is in constant expressions
+* or on builds that can't ask the hardware. cpu_topology() asks once
+* and caches the answer; whatever it can't find out keeps its default.
+*
+* on x86-64 the caches come from cpuid leaf 4 (0x8000001D on AMD), the
+* layout from the x2APIC leaves 0x1F or 0xB (leaf 1 on older parts), and
+* the core type of a hybrid CPU from leaf 0x1A.
+*/
+
+struct CacheInfo {
+  usize  size      = 0; /// Bytes per instance, 0 if there is no such cache.
+  uint32 line_size = 0;
+  uint32 ways      = 0; /// 0 if fully associative or unknown.
+  uint32 shared_by = 0; /// Logical processors sharing one instance, at most.
+};
+
+struct CpuTopology {
+  CacheInfo l1d{32 * 1024, 64, 8, 2};
+  CacheInfo l1i{32 * 1024, 64, 8, 2};
+  CacheInfo l2{256 * 1024, 64, 4, 2};
+  CacheInfo l3{2 * 1024 * 1024, 64, 16, 8};
+
+  uint32 threads_per_core    = 1; /// SMT width of the core that ran the detection.
+  uint32 logical_per_package = 1;
+  uint32 cores_per_package   = 1; /// Derived from the two above; approximate on hybrid CPUs.
+
+  bool hybrid   = false; /// Cores of more than one type, see current_core_type().
+  bool detected = false; /// False if these are all defaults.
+
+  /// Line size of the innermost data cache.
+  NODISCARD_ constexpr auto line_size() const -> usize { return l1d.line_size; }
+};
+
+/// What every field falls back to.
+inline constexpr CpuTopology default_cpu_topology{};
+
+enum class CoreType : uint8 {
+  Uniform,     /// Not a hybrid CPU, all cores are alike.
+  Performance,
+  Efficiency,
+  Unknown,     /// Hybrid, but not a type we recognize.
+};
+
+BEGIN_NAMESPACE(detail_);
+
+#  if defined(ARCH_X86_64)
+/// Leaf 4 and 0x8000001D share a layout: one sub-leaf per cache, until type 0.
+inline auto read_cache_leaf_(uint32 leaf, CpuTopology& out) -> bool {
+  bool found = false;
+  for(uint32 sub = 0; sub < 16; sub++) {
+    const x86_64::CPUID regs(leaf, sub);
+    const uint32 type  = regs.eax() & 0x1F;
+    const uint32 level = (regs.eax() >> 5) & 0x7;
+    if(type == 0) break;
+
+    const uint32 ways       = ((regs.ebx() >> 22) & 0x3FF) + 1;
+    const uint32 partitions = ((regs.ebx() >> 12) & 0x3FF) + 1;
+    const usize  sets       = static_cast<usize>(regs.ecx()) + 1;
+
+    CacheInfo info;
+    info.line_size = (regs.ebx() & 0xFFF) + 1;
+    info.ways      = (regs.eax() & (1u << 9)) ? 0 : ways;
+    info.shared_by = ((regs.eax() >> 14) & 0xFFF) + 1;
+    info.size      = static_cast<usize>(ways) * partitions * info.line_size * sets;
+
+    if(!found) {
+      out.l1d = out.l1i = out.l2 = out.l3 = CacheInfo{};
+      found = true;
+    }
+
+    if(level == 1 && type == 1) out.l1d = info;
+    else if(level == 1 && type == 2) out.l1i = info;
+    else if(level == 2 && type != 2) out.l2 = info;
+    else if(level == 3 && type != 2) out.l3 = info;
+  }
+
+  return found;
+}
+
+/// Leaves 0x1F and 0xB list one level per sub-leaf, innermost (SMT) first, until type 0.
+inline auto read_x2apic_leaf_(uint32 leaf, CpuTopology& out) -> bool {
+  uint32 logical = 0;
+  for(uint32 sub = 0; sub < 16; sub++) {
+    const x86_64::CPUID regs(leaf, sub);
+    const uint32 type  = (regs.ecx() >> 8) & 0xFF;
+    const uint32 count = regs.ebx() & 0xFFFF;
+    if(type == 0 || count == 0) break;
+
+    if(type == 1) out.threads_per_core = count;
+    logical = count;
+  }
+
+  if(logical == 0) return false;
+  out.logical_per_package = logical;
+  return true;
+}
+
+NODISCARD_ inline auto detect_cpu_topology_() -> CpuTopology {
+  CpuTopology out;
+  const auto& features      = x86_64::cpu_features();
+  const uint32 max_basic    = x86_64::CPUID(0).eax();
+  const uint32 max_extended = x86_64::CPUID(0x80000000).eax();
+
+  /// AMD leaves leaf 4 zeroed and has its own copy of it.
+  bool caches = max_basic >= 4 && read_cache_leaf_(4, out);
+  if(!caches && features.has_topoext() && max_extended >= 0x8000001D) {
+    caches = read_cache_leaf_(0x8000001D, out);
+  }
+
+  bool layout = max_basic >= 0x1F && read_x2apic_leaf_(0x1F, out);
+  if(!layout) layout = max_basic >= 0xB && read_x2apic_leaf_(0xB, out);
+  if(!layout && features.has_htt()) {
+    const uint32 logical = (x86_64::CPUID(1).ebx() >> 16) & 0xFF;
+    if(logical != 0) {
+      out.logical_per_package = logical;
+      layout = true;
+    }
+  }
+
+  out.cores_per_package = out.logical_per_package / out.threads_per_core;
+  if(out.cores_per_package == 0) out.cores_per_package = 1;
+
+  out.hybrid   = features.has_hybrid();
+  out.detected = caches || layout;
+  return out;
+}
+#  endif //defined(ARCH_X86_64)
+
+inline constinit CpuTopology cpu_topology_{};
+inline constinit OnceFlag cpu_topology_once_{};
+
+END_NAMESPACE(detail_);
+
+/// The topology of the machine we're running on, or default_cpu_topology where it can't be read.
+NODISCARD_ inline auto cpu_topology() -> const CpuTopology& {
+#  if defined(ARCH_X86_64)
+  detail_::cpu_topology_once_.call([] { detail_::cpu_topology_ = detail_::detect_cpu_topology_(); });
+#  endif
+  return detail_::cpu_topology_;
+}
+
+/// Type of the core the calling thread is on right now. Not cached:
+/// the thread can be moved to another core right after asking.
+NODISCARD_ inline auto current_core_type() -> CoreType {
+#  if defined(ARCH_X86_64)
+  if(!cpu_topology().hybrid || x86_64::CPUID(0).eax() < 0x1A) return CoreType::Uniform;
+  switch(x86_64::CPUID(0x1A).eax() >> 24) {
+    case 0x20: return CoreType::Efficiency;
+    case 0x40: return CoreType::Performance;
+    default: break;
+  }
+  return CoreType::Unknown;
+#  else
+  return CoreType::Uniform;
+#  endif
+}
+
+NODISCARD_ inline auto core_type_to_string(CoreType type) -> const char* {
+  switch(type) {
+    case CoreType::Uniform:     return "uniform";
+    case CoreType::Performance: return "performance";
+    case CoreType::Efficiency:  return "efficiency";
+    case CoreType::Unknown:     return "unknown";
+    default: break;
+  }
+  return "???";
+}
+
+END_NAMESPACE_KTA_
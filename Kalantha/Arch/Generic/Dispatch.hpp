@@ -0,0 +1,198 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/CPUID.hpp>
+#  endif
+
+#  ifdef KTA_ASSUME_TESTING_ENV_
+#include <stdlib.h>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Runtime selection between SIMD variants of a function.
+*
+* CPUs are sorted into tiers, each a superset of the one before it.
+* a Dispatch holds one function pointer per tier (only the scalar one
+* is required) and on first call picks the best variant the current
+* tier allows, then keeps calling through that pointer.
+*
+* the tier can be capped, to test or benchmark the lower variants on
+* a machine that has the higher ones:
+*  - at build time with -DKTA_SIMD_TIER_LIMIT_=Avx2 (any SimdTier name),
+*  - in the testing environment with KTA_SIMD_TIER=scalar|sse4.2|avx2|avx512,
+*  - at runtime with set_simd_tier_limit(), which makes every Dispatch
+*    resolve again on its next call.
+*/
+
+enum class SimdTier : uint8 {
+  Scalar = 0, /// Nothing beyond the baseline target.
+  Sse42  = 1, /// x86-64-v2: SSSE3, SSE4.1, SSE4.2, POPCNT.
+  Avx2   = 2, /// x86-64-v3: AVX, AVX2, BMI1/2, F16C, FMA, LZCNT, MOVBE. Plus PCLMULQDQ.
+  Avx512 = 3, /// x86-64-v4: AVX-512 F, BW, CD, DQ and VL.
+};
+
+inline constexpr usize simd_tier_count = 4;
+
+BEGIN_NAMESPACE(detail_);
+
+/// Best tier the CPU and OS support, before any limits.
+NODISCARD_ inline auto hardware_simd_tier_() -> SimdTier {
+#  if defined(ARCH_X86_64)
+  const auto& f = x86_64::cpu_features();
+  if(!(f.has_ssse3() && f.has_sse4_1() && f.has_sse4_2() && f.has_popcnt())) {
+    return SimdTier::Scalar;
+  }
+
+  if(!(f.has_avx2() && f.has_bmi1() && f.has_bmi2() && f.has_f16c() && f.has_fma()
+    && f.has_lzcnt() && f.has_movbe() && f.has_pclmul())) {
+    return SimdTier::Sse42;
+  }
+
+  if(!(f.has_avx512f() && f.has_avx512bw() && f.has_avx512cd() && f.has_avx512dq() && f.has_avx512vl())) {
+    return SimdTier::Avx2;
+  }
+
+  return SimdTier::Avx512;
+#  else
+  return SimdTier::Scalar;
+#  endif
+}
+
+NODISCARD_ inline auto build_simd_tier_limit_() -> SimdTier {
+#  if defined(KTA_SIMD_TIER_LIMIT_)
+  return SimdTier::KTA_SIMD_TIER_LIMIT_;
+#  else
+  return SimdTier::Avx512;
+#  endif
+}
+
+NODISCARD_ inline auto env_simd_tier_limit_() -> SimdTier {
+#  ifdef KTA_ASSUME_TESTING_ENV_
+  const char* env = ::getenv("KTA_SIMD_TIER");
+  if(env == nullptr) return SimdTier::Avx512;
+
+  constexpr const char* names[simd_tier_count] = {"scalar", "sse4.2", "avx2", "avx512"};
+  for(usize i = 0; i < simd_tier_count; i++) {
+    if(__builtin_strcmp(env, names[i]) == 0) return static_cast<SimdTier>(i);
+  }
+#  endif
+  return SimdTier::Avx512;
+}
+
+/// The hardware tier, capped by the build and environment limits and by limit.
+NODISCARD_ inline auto capped_simd_tier_(SimdTier limit) -> uint8 {
+  uint8 tier = static_cast<uint8>(hardware_simd_tier_());
+  const SimdTier caps[] = {build_simd_tier_limit_(), env_simd_tier_limit_(), limit};
+  for(const SimdTier cap : caps) {
+    if(static_cast<uint8>(cap) < tier) tier = static_cast<uint8>(cap);
+  }
+  return tier;
+}
+
+constexpr uint8 simd_tier_unknown_ = 0xFF;
+
+/// The tier in effect, simd_tier_unknown_ until first asked for.
+inline constinit Atomic<uint8> simd_tier_{simd_tier_unknown_};
+
+/// Bumped whenever the tier changes; a Dispatch resolved at an
+/// older generation resolves again. Starts at 1 so that 0 can
+/// mean "never resolved".
+inline constinit Atomic<uint32> dispatch_generation_{1};
+
+END_NAMESPACE(detail_);
+
+/// The tier dispatched functions run at: what the CPU supports, capped by any limits.
+NODISCARD_ inline auto simd_tier() -> SimdTier {
+  uint8 tier = detail_::simd_tier_.load(MemoryOrder::Relaxed);
+  if(tier == detail_::simd_tier_unknown_) [[unlikely]] {
+    /// Only fill in the default, never overwrite a limit set meanwhile.
+    uint8 expected = detail_::simd_tier_unknown_;
+    const uint8 detected = detail_::capped_simd_tier_(SimdTier::Avx512);
+    tier = detail_::simd_tier_.compare_exchange_strong(expected, detected, MemoryOrder::Relaxed)
+      ? detected
+      : expected;
+  }
+
+  return static_cast<SimdTier>(tier);
+}
+
+/// Caps the tier at limit (never raising it above what the CPU supports,
+/// the build allows or KTA_SIMD_TIER asks for). Meant for tests and
+/// benchmarks: calls racing with this may still run the previous variant.
+inline auto set_simd_tier_limit(SimdTier limit) -> void {
+  detail_::simd_tier_.store(detail_::capped_simd_tier_(limit), MemoryOrder::Relaxed);
+  detail_::dispatch_generation_.fetch_add(1, MemoryOrder::Release);
+}
+
+NODISCARD_ inline auto simd_tier_to_string(SimdTier tier) -> const char* {
+  switch(tier) {
+    case SimdTier::Scalar: return "scalar";
+    case SimdTier::Sse42:  return "sse4.2";
+    case SimdTier::Avx2:   return "avx2";
+    case SimdTier::Avx512: return "avx512";
+    default: break;
+  }
+  return "???";
+}
+
+template<typename Signature>
+class Dispatch;
+
+/// Meant to be declared as an inline constinit global, e.g.
+///   inline constinit Dispatch<uint32(const uint8*, usize)> crc_{&crc_sw, &crc_sse42};
+/// Tiers without a variant of their own fall back to the next one down.
+template<typename R, typename ...Args>
+class Dispatch<R(Args...)> {
+  KTA_MAKE_NONCOPYABLE(Dispatch);
+  KTA_MAKE_NONMOVABLE(Dispatch);
+public:
+  using FnPtr = R(*)(Args...);
+
+  FORCEINLINE_ auto operator()(Args... args) -> R {
+    return get()(kta::forward<Args>(args)...);
+  }
+
+  /// The variant for the current tier, resolving it if needed.
+  NODISCARD_ FORCEINLINE_ auto get() -> FnPtr {
+    if(generation_.load(MemoryOrder::Acquire) != detail_::dispatch_generation_.load(MemoryOrder::Relaxed)) [[unlikely]] {
+      resolve_();
+    }
+    return fn_.load(MemoryOrder::Relaxed);
+  }
+
+  /// The best variant at or below the given tier.
+  NODISCARD_ constexpr auto variant_for(SimdTier tier) const -> FnPtr {
+    for(usize i = static_cast<usize>(tier); i > 0; i--) {
+      if(variants_[i] != nullptr) return variants_[i];
+    }
+    return variants_[0];
+  }
+
+  constexpr explicit Dispatch(FnPtr scalar, FnPtr sse42 = nullptr, FnPtr avx2 = nullptr, FnPtr avx512 = nullptr)
+    : variants_{scalar, sse42, avx2, avx512} {}
+private:
+  NOINLINE_ auto resolve_() -> void {
+    const uint32 generation = detail_::dispatch_generation_.load(MemoryOrder::Acquire);
+    fn_.store(variant_for(simd_tier()), MemoryOrder::Relaxed);
+    generation_.store(generation, MemoryOrder::Release);
+  }
+
+  FnPtr variants_[simd_tier_count];
+  Atomic<FnPtr>  fn_{};
+  Atomic<uint32> generation_{};
+};
+
+END_NAMESPACE_KTA_
@@ -10,6 +10,13 @@
 #include <Kalantha/Core/Types.hpp>
 #include <Kalantha/Meta/TypeTraits.hpp>
 #include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
 BEGIN_NAMESPACE_KTA_
 
 /// Note: we assume these builtins are constexpr-compatible.
@@ -232,4 +239,284 @@ NODISCARD_ constexpr auto little_to_host(T value) noexcept -> T {
   return is_big_endian() ? byteswap(value) : value;
 }
 
+/**
+ * @brief Load a little-endian integer from a possibly unaligned address.
+ * @param ptr Pointer to the first of sizeof(T) bytes to read.
+ * @return The integer, converted to the platform's native byte order.
+ */
+template<Integer T>
+NODISCARD_ FORCEINLINE_ auto load_little(const void* ptr) noexcept -> T {
+  T value;
+  __builtin_memcpy(&value, ptr, sizeof(T));
+  return little_to_host(value);
+}
+
+/**
+ * @brief Load a big-endian integer from a possibly unaligned address.
+ * @param ptr Pointer to the first of sizeof(T) bytes to read.
+ * @return The integer, converted to the platform's native byte order.
+ */
+template<Integer T>
+NODISCARD_ FORCEINLINE_ auto load_big(const void* ptr) noexcept -> T {
+  T value;
+  __builtin_memcpy(&value, ptr, sizeof(T));
+  return big_to_host(value);
+}
+
+/**
+ * @brief Store an integer in little-endian order to a possibly unaligned address.
+ * @param ptr Pointer to the first of sizeof(T) bytes to write.
+ * @param value The integer to store, in the platform's native byte order.
+ */
+template<Integer T>
+FORCEINLINE_ auto store_little(void* ptr, T value) noexcept -> void {
+  value = host_to_little(value);
+  __builtin_memcpy(ptr, &value, sizeof(T));
+}
+
+/**
+ * @brief Store an integer in big-endian order to a possibly unaligned address.
+ * @param ptr Pointer to the first of sizeof(T) bytes to write.
+ * @param value The integer to store, in the platform's native byte order.
+ */
+template<Integer T>
+FORCEINLINE_ auto store_big(void* ptr, T value) noexcept -> void {
+  value = host_to_big(value);
+  __builtin_memcpy(ptr, &value, sizeof(T));
+}
+
+/*
+* Bulk conversions over Spans.
+*
+* a byte shuffle reverses every element of a 16 byte vector at once:
+* pshufb with SSSE3, vpshufb over 32 or 64 bytes with AVX2 or AVX-512.
+* the kernel is picked through a Dispatch on first use, per element
+* size, and the scalar byteswap() above handles the rest.
+*/
+
+namespace detail_ {
+  template<typename U>
+  FORCEINLINE_ auto swap_at(const uint8* src, uint8* dst) -> void {
+    U value;
+    __builtin_memcpy(&value, src, sizeof(U));
+    value = byteswap(value);
+    __builtin_memcpy(dst, &value, sizeof(U));
+  }
+
+  template<usize size_>
+  inline auto byteswap_scalar(const void* src, void* dst, usize count) -> void {
+    const auto* in = static_cast<const uint8*>(src);
+    auto* out = static_cast<uint8*>(dst);
+    for(usize i = 0; i < count * size_; i += size_) {
+      if constexpr(size_ == 2) swap_at<uint16>(in + i, out + i);
+      if constexpr(size_ == 4) swap_at<uint32>(in + i, out + i);
+      if constexpr(size_ == 8) swap_at<uint64>(in + i, out + i);
+    }
+  }
+
+#  if defined(ARCH_X86_64)
+  /// Lane i takes the byte mirrored within its element.
+  template<usize size_>
+  NODISCARD_ FORCEINLINE_ auto byteswap_shuffle() -> x86_64::Vec16i8 {
+    constexpr auto at = [](usize i) { return static_cast<char>((i / size_) * size_ + (size_ - 1 - i % size_)); };
+    return x86_64::Vec16i8{at(0), at(1), at(2),  at(3),  at(4),  at(5),  at(6),  at(7),
+                           at(8), at(9), at(10), at(11), at(12), at(13), at(14), at(15)};
+  }
+
+  template<usize size_>
+  KTA_TARGET_SSSE3_ auto byteswap_ssse3(const void* src, void* dst, usize count) -> void {
+    const auto* in = static_cast<const uint8*>(src);
+    auto* out = static_cast<uint8*>(dst);
+    const usize bytes = count * size_;
+    const x86_64::Vec16i8 mask = byteswap_shuffle<size_>();
+
+    usize i = 0;
+    for(; i + 16 <= bytes; i += 16) {
+      x86_64::store_128(out + i, __builtin_ia32_pshufb128(x86_64::load_128(in + i), mask));
+    }
+    byteswap_scalar<size_>(in + i, out + i, (bytes - i) / size_);
+  }
+
+  template<usize size_>
+  KTA_TARGET_AVX2_ auto byteswap_avx2(const void* src, void* dst, usize count) -> void {
+    using x86_64::Vec32i8;
+    const auto* in = static_cast<const uint8*>(src);
+    auto* out = static_cast<uint8*>(dst);
+    const usize bytes = count * size_;
+
+    /// vpshufb shuffles each 128 bit half separately, so the mask is the same twice.
+    const x86_64::Vec16i8 half = byteswap_shuffle<size_>();
+    const Vec32i8 mask = __builtin_shufflevector(half, half,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    usize i = 0;
+    for(; i + 64 <= bytes; i += 64) {
+      const auto a = __builtin_bit_cast(Vec32i8, x86_64::load_256(in + i));
+      const auto b = __builtin_bit_cast(Vec32i8, x86_64::load_256(in + i + 32));
+      x86_64::store_256(out + i, __builtin_bit_cast(x86_64::Vec4u64, __builtin_ia32_pshufb256(a, mask)));
+      x86_64::store_256(out + i + 32, __builtin_bit_cast(x86_64::Vec4u64, __builtin_ia32_pshufb256(b, mask)));
+    }
+    for(; i + 32 <= bytes; i += 32) {
+      const auto a = __builtin_bit_cast(Vec32i8, x86_64::load_256(in + i));
+      x86_64::store_256(out + i, __builtin_bit_cast(x86_64::Vec4u64, __builtin_ia32_pshufb256(a, mask)));
+    }
+    byteswap_scalar<size_>(in + i, out + i, (bytes - i) / size_);
+  }
+
+  template<usize size_>
+  KTA_TARGET_AVX512_ auto byteswap_avx512(const void* src, void* dst, usize count) -> void {
+    using x86_64::Vec64i8;
+    const auto* in = static_cast<const uint8*>(src);
+    auto* out = static_cast<uint8*>(dst);
+    const usize bytes = count * size_;
+
+    const x86_64::Vec16i8 quarter = byteswap_shuffle<size_>();
+    const Vec64i8 mask = __builtin_shufflevector(quarter, quarter,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    usize i = 0;
+    for(; i + 64 <= bytes; i += 64) {
+      Vec64i8 vec;
+      __builtin_memcpy(&vec, in + i, sizeof(vec));
+#    if KTA_CLANG
+      vec = __builtin_ia32_pshufb512(vec, mask);
+#    else
+      vec = __builtin_ia32_pshufb512_mask(vec, mask, vec, ~0ull);
+#    endif
+      __builtin_memcpy(out + i, &vec, sizeof(vec));
+    }
+    byteswap_avx2<size_>(in + i, out + i, (bytes - i) / size_);
+  }
+#  endif //defined(ARCH_X86_64)
+
+  /// SSSE3 is part of the SSE4.2 tier.
+  template<usize size_>
+  inline constinit Dispatch<void(const void*, void*, usize)> byteswap_impl{
+    &byteswap_scalar<size_>,
+#  if defined(ARCH_X86_64)
+    &byteswap_ssse3<size_>,
+    &byteswap_avx2<size_>,
+    &byteswap_avx512<size_>,
+#  endif
+  };
+
+  template<usize size_>
+  inline auto byteswap_bulk(const void* src, void* dst, usize count) -> void {
+    if constexpr(size_ == 1) {
+      if(src != dst && count != 0) __builtin_memmove(dst, src, count);
+    } else {
+      byteswap_impl<size_>(src, dst, count);
+    }
+  }
+
+  template<typename T>
+  inline auto copy_bulk(const T* src, T* dst, usize count) -> void {
+    if(src != dst && count != 0) __builtin_memmove(dst, src, count * sizeof(T));
+  }
+}
+
+/**
+ * @brief Swap the endianness of every integer in a span, in place.
+ * @param values The integers to perform the swap on.
+ */
+template<Integer T>
+auto byteswap(Span<T> values) -> void {
+  detail_::byteswap_bulk<sizeof(T)>(values.data(), values.data(), values.size());
+}
+
+/**
+ * @brief Write the byte-swapped integers of src to dst.
+ * @param src The integers to read. May be the same span as dst, but must not partially overlap it.
+ * @param dst Where to write them. Must hold at least src.size() elements.
+ */
+template<typename S, Integer T> requires IsSame<RemoveCV<S>, T>
+auto byteswap(Span<S> src, Span<T> dst) -> void {
+  KTA_ASSERT(dst.size() >= src.size(), "byteswap: destination is too small");
+  detail_::byteswap_bulk<sizeof(T)>(src.data(), dst.data(), src.size());
+}
+
+/**
+ * @brief Convert every integer in a span from host byte order to big-endian, in place.
+ * @param values The integers to convert.
+ */
+template<Integer T>
+auto host_to_big(Span<T> values) -> void {
+  if(is_little_endian()) byteswap(values);
+}
+
+/**
+ * @brief Convert the host-order integers of src to big-endian, writing them to dst.
+ * @param src The integers to read. May be the same span as dst, but must not partially overlap it.
+ * @param dst Where to write them. Must hold at least src.size() elements.
+ */
+template<typename S, Integer T> requires IsSame<RemoveCV<S>, T>
+auto host_to_big(Span<S> src, Span<T> dst) -> void {
+  if(is_little_endian()) byteswap(src, dst);
+  else detail_::copy_bulk(src.data(), dst.data(), src.size());
+}
+
+/**
+ * @brief Convert every integer in a span from big-endian to host byte order, in place.
+ * @param values The integers to convert.
+ */
+template<Integer T>
+auto big_to_host(Span<T> values) -> void {
+  if(is_little_endian()) byteswap(values);
+}
+
+/**
+ * @brief Convert the big-endian integers of src to host byte order, writing them to dst.
+ * @param src The integers to read. May be the same span as dst, but must not partially overlap it.
+ * @param dst Where to write them. Must hold at least src.size() elements.
+ */
+template<typename S, Integer T> requires IsSame<RemoveCV<S>, T>
+auto big_to_host(Span<S> src, Span<T> dst) -> void {
+  if(is_little_endian()) byteswap(src, dst);
+  else detail_::copy_bulk(src.data(), dst.data(), src.size());
+}
+
+/**
+ * @brief Convert every integer in a span from host byte order to little-endian, in place.
+ * @param values The integers to convert.
+ */
+template<Integer T>
+auto host_to_little(Span<T> values) -> void {
+  if(is_big_endian()) byteswap(values);
+}
+
+/**
+ * @brief Convert the host-order integers of src to little-endian, writing them to dst.
+ * @param src The integers to read. May be the same span as dst, but must not partially overlap it.
+ * @param dst Where to write them. Must hold at least src.size() elements.
+ */
+template<typename S, Integer T> requires IsSame<RemoveCV<S>, T>
+auto host_to_little(Span<S> src, Span<T> dst) -> void {
+  if(is_big_endian()) byteswap(src, dst);
+  else detail_::copy_bulk(src.data(), dst.data(), src.size());
+}
+
+/**
+ * @brief Convert every integer in a span from little-endian to host byte order, in place.
+ * @param values The integers to convert.
+ */
+template<Integer T>
+auto little_to_host(Span<T> values) -> void {
+  if(is_big_endian()) byteswap(values);
+}
+
+/**
+ * @brief Convert the little-endian integers of src to host byte order, writing them to dst.
+ * @param src The integers to read. May be the same span as dst, but must not partially overlap it.
+ * @param dst Where to write them. Must hold at least src.size() elements.
+ */
+template<typename S, Integer T> requires IsSame<RemoveCV<S>, T>
+auto little_to_host(Span<S> src, Span<T> dst) -> void {
+  if(is_big_endian()) byteswap(src, dst);
+  else detail_::copy_bulk(src.data(), dst.data(), src.size());
+}
+
 END_NAMESPACE_KTA_
@@ -8,12 +8,17 @@
 #include <Kalantha/Core/Common.hpp>
 #include <Kalantha/Core/Types.hpp>
 #include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Locks.hpp>
 BEGIN_NAMESPACE(kta::x86_64);
 
 /*
-* An extremely naive CPUID wrapper.
-* lots of work needs to be done here for this to be as
-* useful as other ones available.
+* CPUID is a thin wrapper over a single cpuid query; its has_*()
+* methods decode leaf 1 only and say nothing about OS support.
+*
+* CpuFeatures decodes leaves 1, 7 (sub-leaves 0 and 1) and 0x80000001
+* at once, and masks out whatever needs register state the OS doesn't
+* save according to XCR0 (AVX, AVX-512 and AMX). cpu_features() does
+* this once and caches the result, so it's cheap enough to ask often.
 */
 
 #define CPUID_ECX_FEATURES_LIST_ \
@@ -81,6 +86,100 @@ BEGIN_NAMESPACE(kta::x86_64);
   X(ia64,    1u << 30u, "IA64 processor emulating x86") \
   X(pbe,     1u << 31u, "Pending Break Enable")
 
+#define CPUID_LEAF7_EBX_FEATURES_LIST_ \
+  X(fsgsbase,   1u << 0u,  "RDFSBASE/RDGSBASE/WRFSBASE/WRGSBASE Instructions") \
+  X(bmi1,       1u << 3u,  "Bit Manipulation Instruction Set 1") \
+  X(hle,        1u << 4u,  "Hardware Lock Elision") \
+  X(avx2,       1u << 5u,  "Advanced Vector Extensions 2") \
+  X(smep,       1u << 7u,  "Supervisor Mode Execution Prevention") \
+  X(bmi2,       1u << 8u,  "Bit Manipulation Instruction Set 2") \
+  X(erms,       1u << 9u,  "Enhanced REP MOVSB/STOSB") \
+  X(invpcid,    1u << 10u, "INVPCID Instruction") \
+  X(rtm,        1u << 11u, "Restricted Transactional Memory") \
+  X(avx512f,    1u << 16u, "AVX-512 Foundation") \
+  X(avx512dq,   1u << 17u, "AVX-512 Doubleword and Quadword Instructions") \
+  X(rdseed,     1u << 18u, "RDSEED Instruction") \
+  X(adx,        1u << 19u, "Multi-Precision Add-Carry Instruction Extensions") \
+  X(smap,       1u << 20u, "Supervisor Mode Access Prevention") \
+  X(avx512ifma, 1u << 21u, "AVX-512 Integer Fused Multiply-Add") \
+  X(clflushopt, 1u << 23u, "CLFLUSHOPT Instruction") \
+  X(clwb,       1u << 24u, "CLWB Instruction") \
+  X(avx512pf,   1u << 26u, "AVX-512 Prefetch Instructions") \
+  X(avx512er,   1u << 27u, "AVX-512 Exponential and Reciprocal Instructions") \
+  X(avx512cd,   1u << 28u, "AVX-512 Conflict Detection Instructions") \
+  X(sha,        1u << 29u, "SHA Extensions") \
+  X(avx512bw,   1u << 30u, "AVX-512 Byte and Word Instructions") \
+  X(avx512vl,   1u << 31u, "AVX-512 Vector Length Extensions")
+
+#define CPUID_LEAF7_ECX_FEATURES_LIST_ \
+  X(prefetchwt1,     1u << 0u,  "PREFETCHWT1 Instruction") \
+  X(avx512vbmi,      1u << 1u,  "AVX-512 Vector Bit Manipulation Instructions") \
+  X(umip,            1u << 2u,  "User-Mode Instruction Prevention") \
+  X(pku,             1u << 3u,  "Memory Protection Keys for User-mode pages") \
+  X(ospke,           1u << 4u,  "OS-Enabled Protection Keys") \
+  X(waitpkg,         1u << 5u,  "TPAUSE/UMONITOR/UMWAIT Instructions") \
+  X(avx512vbmi2,     1u << 6u,  "AVX-512 Vector Bit Manipulation Instructions 2") \
+  X(gfni,            1u << 8u,  "Galois Field Instructions") \
+  X(vaes,            1u << 9u,  "Vector AES Instructions") \
+  X(vpclmulqdq,      1u << 10u, "Vector CLMUL Instruction") \
+  X(avx512vnni,      1u << 11u, "AVX-512 Vector Neural Network Instructions") \
+  X(avx512bitalg,    1u << 12u, "AVX-512 BITALG Instructions") \
+  X(avx512vpopcntdq, 1u << 14u, "AVX-512 Vector Population Count") \
+  X(rdpid,           1u << 22u, "RDPID Instruction") \
+  X(cldemote,        1u << 25u, "CLDEMOTE Instruction") \
+  X(movdiri,         1u << 27u, "MOVDIRI Instruction") \
+  X(movdir64b,       1u << 28u, "MOVDIR64B Instruction")
+
+#define CPUID_LEAF7_EDX_FEATURES_LIST_ \
+  X(avx512_4vnniw,      1u << 2u,  "AVX-512 4-register Neural Network Instructions") \
+  X(avx512_4fmaps,      1u << 3u,  "AVX-512 4-register Multiply Accumulation Single Precision") \
+  X(fsrm,               1u << 4u,  "Fast Short REP MOVSB") \
+  X(avx512vp2intersect, 1u << 8u,  "AVX-512 VP2INTERSECT Instructions") \
+  X(md_clear,           1u << 10u, "VERW Clears CPU Buffers") \
+  X(serialize,          1u << 14u, "SERIALIZE Instruction") \
+  X(hybrid,             1u << 15u, "Hybrid Processor (mixed core types)") \
+  X(amx_bf16,           1u << 22u, "AMX bfloat16 Tile Computations") \
+  X(avx512fp16,         1u << 23u, "AVX-512 Half-Precision Floating Point") \
+  X(amx_tile,           1u << 24u, "AMX Tile Architecture") \
+  X(amx_int8,           1u << 25u, "AMX 8-bit Integer Tile Computations")
+
+#define CPUID_LEAF7_1_EAX_FEATURES_LIST_ \
+  X(avx_vnni,   1u << 4u,  "AVX (VEX-encoded) Vector Neural Network Instructions") \
+  X(avx512bf16, 1u << 5u,  "AVX-512 bfloat16 Instructions") \
+  X(fzlrm,      1u << 10u, "Fast Zero-Length REP MOVSB") \
+  X(fsrs,       1u << 11u, "Fast Short REP STOSB") \
+  X(fsrcs,      1u << 12u, "Fast Short REP CMPSB/SCASB") \
+  X(hreset,     1u << 22u, "HRESET Instruction") \
+  X(lam,        1u << 26u, "Linear Address Masking")
+
+#define CPUID_EXT_ECX_FEATURES_LIST_ \
+  X(lahf_lm,   1u << 0u,  "LAHF/SAHF in 64-bit Mode") \
+  X(lzcnt,     1u << 5u,  "LZCNT Instruction") \
+  X(sse4a,     1u << 6u,  "SSE4a Instructions") \
+  X(prefetchw, 1u << 8u,  "PREFETCHW Instruction") \
+  X(xop,       1u << 11u, "Extended Operations") \
+  X(fma4,      1u << 16u, "4-operand Fused Multiply Add") \
+  X(tbm,       1u << 21u, "Trailing Bit Manipulation") \
+  X(topoext,   1u << 22u, "Topology Extensions")
+
+#define CPUID_EXT_EDX_FEATURES_LIST_ \
+  X(syscall, 1u << 11u, "SYSCALL/SYSRET Instructions") \
+  X(nx,      1u << 20u, "No-Execute Page Protection") \
+  X(mmxext,  1u << 22u, "Extended MMX") \
+  X(pdpe1gb, 1u << 26u, "1 GiB Pages") \
+  X(rdtscp,  1u << 27u, "RDTSCP Instruction") \
+  X(lm,      1u << 29u, "Long Mode")
+
+#define CPUID_ALL_FEATURES_LIST_ \
+  CPUID_ECX_FEATURES_LIST_ \
+  CPUID_EDX_FEATURES_LIST_ \
+  CPUID_LEAF7_EBX_FEATURES_LIST_ \
+  CPUID_LEAF7_ECX_FEATURES_LIST_ \
+  CPUID_LEAF7_EDX_FEATURES_LIST_ \
+  CPUID_LEAF7_1_EAX_FEATURES_LIST_ \
+  CPUID_EXT_ECX_FEATURES_LIST_ \
+  CPUID_EXT_EDX_FEATURES_LIST_
+
 struct CPU_Vendor {
   char buff[16]{};
 };
@@ -178,4 +277,174 @@ inline CPUID::CPUID(RegType func, RegType in_ecx) {
     : "a"(func), "c"(in_ecx));
 }
 
+class CpuFeatures {
+public:
+  enum class Feature : uint32 {
+  #define X(IDENT, VALUE, UNUSED) IDENT,
+    CPUID_ALL_FEATURES_LIST_
+  #undef X
+  };
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return leaf1_ecx_ & (VALUE); }
+    CPUID_ECX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return leaf1_edx_ & (VALUE); }
+    CPUID_EDX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return leaf7_ebx_ & (VALUE); }
+    CPUID_LEAF7_EBX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return leaf7_ecx_ & (VALUE); }
+    CPUID_LEAF7_ECX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return leaf7_edx_ & (VALUE); }
+    CPUID_LEAF7_EDX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return leaf7_1_eax_ & (VALUE); }
+    CPUID_LEAF7_1_EAX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return ext_ecx_ & (VALUE); }
+    CPUID_EXT_ECX_FEATURES_LIST_
+  #undef X
+
+  #define X(IDENT, VALUE, UNUSED) bool has_##IDENT() const { return ext_edx_ & (VALUE); }
+    CPUID_EXT_EDX_FEATURES_LIST_
+  #undef X
+
+  bool has_feature(const Feature feature) const {
+    switch(feature) {
+  #define X(IDENT, VALUE, UNUSED) case Feature::IDENT: return has_##IDENT();
+    CPUID_ALL_FEATURES_LIST_
+  #undef X
+    default: return false;
+    }
+  }
+
+  static const char* get_feature_desc(const Feature feature) {
+    switch(feature) {
+    #define X(IDENT, VALUE, STR) case Feature::IDENT: return STR;
+      CPUID_ALL_FEATURES_LIST_
+    #undef X
+    default: break;
+    }
+    return "???";
+  }
+
+  static const char* feature_to_string(const Feature feature) {
+    switch(feature) {
+    #define X(IDENT, VALUE, UNUSED) case Feature::IDENT: return #IDENT;
+      CPUID_ALL_FEATURES_LIST_
+    #undef X
+    default: break;
+    }
+    return "???";
+  }
+
+  /// XCR0: the register state the OS saves across context switches. 0 without OSXSAVE.
+  uint64 xcr0() const { return xcr0_; }
+
+  /// Runs cpuid (and xgetbv) now. Prefer cpu_features(), which caches this.
+  static CpuFeatures detect();
+
+  constexpr CpuFeatures() = default;
+private:
+  /// XCR0 bits: SSE | AVX, then AVX-512 opmask | ZMM_Hi256 | Hi16_ZMM, then TILECFG | TILEDATA.
+  static constexpr uint64 xcr0_avx_    = 0x6;
+  static constexpr uint64 xcr0_avx512_ = 0xE0;
+  static constexpr uint64 xcr0_amx_    = 0x60000;
+
+  uint32 leaf1_ecx_   = 0;
+  uint32 leaf1_edx_   = 0;
+  uint32 leaf7_ebx_   = 0;
+  uint32 leaf7_ecx_   = 0;
+  uint32 leaf7_edx_   = 0;
+  uint32 leaf7_1_eax_ = 0;
+  uint32 ext_ecx_     = 0;
+  uint32 ext_edx_     = 0;
+  uint64 xcr0_        = 0;
+};
+
+namespace detail_ {
+  NODISCARD_ inline auto xgetbv_(uint32 index) -> uint64 {
+    uint32 eax = 0, edx = 0;
+    asm volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return (static_cast<uint64>(edx) << 32) | eax;
+  }
+
+  inline constinit CpuFeatures cpu_features_{};
+  inline constinit OnceFlag cpu_features_once_{};
+}
+
+inline CpuFeatures CpuFeatures::detect() {
+  CpuFeatures out;
+  const uint32 max_basic    = CPUID(0).eax();
+  const uint32 max_extended = CPUID(0x80000000).eax();
+
+  const CPUID leaf1(1);
+  out.leaf1_ecx_ = leaf1.ecx();
+  out.leaf1_edx_ = leaf1.edx();
+
+  if(max_basic >= 7) {
+    const CPUID leaf7(7, 0);
+    out.leaf7_ebx_ = leaf7.ebx();
+    out.leaf7_ecx_ = leaf7.ecx();
+    out.leaf7_edx_ = leaf7.edx();
+    if(leaf7.eax() >= 1) out.leaf7_1_eax_ = CPUID(7, 1).eax();
+  }
+
+  if(max_extended >= 0x80000001) {
+    const CPUID ext(0x80000001);
+    out.ext_ecx_ = ext.ecx();
+    out.ext_edx_ = ext.edx();
+  }
+
+  if(out.has_osxsave()) out.xcr0_ = detail_::xgetbv_(0);
+
+  /// Clear whatever the OS won't save the registers for.
+  /// AVX-512 also needs YMM state, and AMX needs AVX-512's.
+  const bool os_avx    = (out.xcr0_ & xcr0_avx_) == xcr0_avx_;
+  const bool os_avx512 = os_avx && (out.xcr0_ & xcr0_avx512_) == xcr0_avx512_;
+  const bool os_amx    = os_avx512 && (out.xcr0_ & xcr0_amx_) == xcr0_amx_;
+
+  enum : uint32 {
+  #define X(IDENT, VALUE, UNUSED) IDENT = VALUE,
+    CPUID_ALL_FEATURES_LIST_
+  #undef X
+  };
+
+  if(!os_avx) {
+    out.leaf1_ecx_   &= ~(fma | avx | f16c);
+    out.leaf7_ebx_   &= ~avx2;
+    out.leaf7_ecx_   &= ~(vaes | vpclmulqdq);
+    out.leaf7_1_eax_ &= ~avx_vnni;
+    out.ext_ecx_     &= ~(xop | fma4);
+  }
+
+  if(!os_avx512) {
+    out.leaf7_ebx_   &= ~(avx512f | avx512dq | avx512ifma | avx512pf | avx512er | avx512cd | avx512bw | avx512vl);
+    out.leaf7_ecx_   &= ~(avx512vbmi | avx512vbmi2 | avx512vnni | avx512bitalg | avx512vpopcntdq);
+    out.leaf7_edx_   &= ~(avx512_4vnniw | avx512_4fmaps | avx512vp2intersect | avx512fp16);
+    out.leaf7_1_eax_ &= ~avx512bf16;
+  }
+
+  /// Linux additionally wants ARCH_REQ_XCOMP_PERM before AMX is used; that's up to the caller.
+  if(!os_amx) {
+    out.leaf7_edx_ &= ~(amx_bf16 | amx_tile | amx_int8);
+  }
+
+  return out;
+}
+
+/// The features of the CPU we're running on, as far as the OS lets us use them.
+NODISCARD_ inline auto cpu_features() -> const CpuFeatures& {
+  detail_::cpu_features_once_.call([] { detail_::cpu_features_ = CpuFeatures::detect(); });
+  return detail_::cpu_features_;
+}
+
 END_NAMESPACE(kta::x86_64);
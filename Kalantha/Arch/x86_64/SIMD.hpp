@@ -0,0 +1,80 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Arch/x86_64/CPUID.hpp>
+BEGIN_NAMESPACE(kta::x86_64);
+
+/*
+* Thin wrappers over GCC-style vector extensions.
+* we deliberately avoid <immintrin.h> here, since some compilers drag in
+* parts of the hosted C library through it (mm_malloc.h and friends).
+*
+* SSE2 is part of the x86_64 baseline, anything beyond that
+* must be guarded by a runtime check and a target attribute.
+*/
+
+#define KTA_TARGET_AVX2_         __attribute__((target("avx2")))
+#define KTA_TARGET_SSSE3_        __attribute__((target("ssse3")))
+#define KTA_TARGET_SSE42_        __attribute__((target("sse4.2")))
+#define KTA_TARGET_SSE42_PCLMUL_ __attribute__((target("sse4.2,pclmul")))
+#define KTA_TARGET_AVX512_       __attribute__((target("avx512f,avx512bw,avx512cd,avx512dq,avx512vl")))
+
+using Vec16i8 = char __attribute__((vector_size(16)));
+using Vec32i8 = char __attribute__((vector_size(32)));
+using Vec64i8 = char __attribute__((vector_size(64)));
+using Vec2i64 = long long __attribute__((vector_size(16)));
+using Vec4u64 = uint64 __attribute__((vector_size(32)));
+using Vec8i32 = int32 __attribute__((vector_size(32)));
+using Vec4i64 = long long __attribute__((vector_size(32)));
+
+NODISCARD_ FORCEINLINE_ auto load_128(const void* ptr) -> Vec16i8 {
+  Vec16i8 vec;
+  __builtin_memcpy(&vec, ptr, sizeof(vec));
+  return vec;
+}
+
+FORCEINLINE_ auto store_128(void* ptr, Vec16i8 vec) -> void {
+  __builtin_memcpy(ptr, &vec, sizeof(vec));
+}
+
+NODISCARD_ FORCEINLINE_ auto splat_128(char c) -> Vec16i8 {
+  return Vec16i8{c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c};
+}
+
+NODISCARD_ FORCEINLINE_ auto cmpeq_128(Vec16i8 a, Vec16i8 b) -> Vec16i8 {
+  return __builtin_bit_cast(Vec16i8, a == b);
+}
+
+/// One bit per byte lane, taken from the lane's sign bit (pmovmskb).
+NODISCARD_ FORCEINLINE_ auto movemask_128(Vec16i8 vec) -> uint32 {
+  return static_cast<uint32>(__builtin_ia32_pmovmskb128(vec));
+}
+
+/// 256-bit helpers can only be inlined into AVX2 functions.
+NODISCARD_ KTA_TARGET_AVX2_ FORCEINLINE_ auto load_256(const void* ptr) -> Vec4u64 {
+  Vec4u64 vec;
+  __builtin_memcpy(&vec, ptr, sizeof(vec));
+  return vec;
+}
+
+KTA_TARGET_AVX2_ FORCEINLINE_ auto store_256(void* ptr, Vec4u64 vec) -> void {
+  __builtin_memcpy(ptr, &vec, sizeof(vec));
+}
+
+/// AVX2 needs CPU support *and* the OS saving YMM state; see CpuFeatures.
+NODISCARD_ inline auto cpu_has_avx2() -> bool {
+  return cpu_features().has_avx2();
+}
+
+NODISCARD_ inline auto cpu_has_ssse3() -> bool {
+  return cpu_features().has_ssse3();
+}
+
+END_NAMESPACE(kta::x86_64);
@@ -0,0 +1,94 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Arch/x86_64/CPUID.hpp>
+BEGIN_NAMESPACE(kta::x86_64);
+
+/*
+* The time stamp counter. rdtsc is a few dozen cycles and
+* doesn't serialize, so the CPU may run it ahead of or behind
+* the surrounding code; rdtsc_ordered() and rdtscp() don't start
+* until everything before them has finished.
+*
+* on CPUs with an invariant TSC it ticks at a constant rate
+* regardless of frequency scaling and sleep states, and is in sync
+* across cores, which is what makes it usable as a clock at all.
+*/
+
+NODISCARD_ FORCEINLINE_ auto rdtsc() -> uint64 {
+  return __builtin_ia32_rdtsc();
+}
+
+/// rdtsc, after all earlier instructions have completed.
+NODISCARD_ FORCEINLINE_ auto rdtsc_ordered() -> uint64 {
+  __builtin_ia32_lfence();
+  return __builtin_ia32_rdtsc();
+}
+
+/// Also waits for earlier instructions. aux gets IA32_TSC_AUX,
+/// which operating systems set to the current CPU number.
+NODISCARD_ FORCEINLINE_ auto rdtscp(uint32& aux) -> uint64 {
+  return __builtin_ia32_rdtscp(&aux);
+}
+
+NODISCARD_ FORCEINLINE_ auto rdtscp() -> uint64 {
+  uint32 aux;
+  return __builtin_ia32_rdtscp(&aux);
+}
+
+/// Whether the TSC runs at a constant rate in every P-, C- and T-state (0x80000007 EDX bit 8).
+NODISCARD_ inline auto has_invariant_tsc() -> bool {
+  if(CPUID(0x80000000).eax() < 0x80000007) return false;
+  return CPUID(0x80000007).edx() & (1u << 8u);
+}
+
+/// TSC frequency in Hz as reported by cpuid, 0 if it isn't.
+/// Leaf 0x15 gives the crystal clock and the TSC/crystal ratio; some
+/// CPUs leave the crystal clock out, then the TSC runs at the base
+/// frequency from leaf 0x16.
+NODISCARD_ inline auto tsc_frequency_from_cpuid() -> uint64 {
+  const uint32 max_basic = CPUID(0).eax();
+  if(max_basic >= 0x15) {
+    const CPUID leaf(0x15);
+    const uint64 denominator = leaf.eax();
+    const uint64 numerator   = leaf.ebx();
+    const uint64 crystal_hz  = leaf.ecx();
+    if(denominator != 0 && numerator != 0 && crystal_hz != 0) {
+      return crystal_hz * numerator / denominator;
+    }
+  }
+
+  if(max_basic >= 0x16) {
+    const uint64 base_mhz = CPUID(0x16).eax() & 0xFFFF;
+    return base_mhz * 1'000'000;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Measure the TSC frequency against another clock.
+ * @param now_ns The reference clock, in nanoseconds.
+ * @param duration_ns How long to measure for. Longer is more precise.
+ * @return The frequency in Hz.
+ */
+inline auto calibrate_tsc_frequency(uint64 (*now_ns)(), uint64 duration_ns = 10'000'000) -> uint64 {
+  const uint64 ns_begin  = now_ns();
+  const uint64 tsc_begin = rdtsc_ordered();
+
+  uint64 ns_end = ns_begin;
+  while(ns_end - ns_begin < duration_ns) ns_end = now_ns();
+  const uint64 tsc_end = rdtsc_ordered();
+
+  const unsigned __int128 cycles = tsc_end - tsc_begin;
+  return static_cast<uint64>(cycles * 1'000'000'000 / (ns_end - ns_begin));
+}
+
+END_NAMESPACE(kta::x86_64);
@@ -8,7 +8,16 @@
 #include <Kalantha/Core/Common.hpp>
 #include <Kalantha/Core/Types.hpp>
 #include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Option.hpp>
 #include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
 BEGIN_NAMESPACE_KTA_
 
 template<TotallyOrdered T>
@@ -26,4 +35,1079 @@ NODISCARD_ constexpr auto clamp(const T& v, const T& lo, const T& hi) -> const T
   return (v < lo) ? lo : ((hi < v) ? hi : v);
 }
 
+/*
+* Span algorithms.
+*
+* the loops work on raw pointers with no bounds checks or early exits,
+* so the compiler is free to vectorize them. parallel versions
+* live in ParallelAlgorithm.hpp.
+*/
+
+BEGIN_NAMESPACE(detail_);
+
+struct Plus_ {
+  template<typename A, typename B>
+  NODISCARD_ constexpr auto operator()(const A& a, const B& b) const { return a + b; }
+};
+
+/// Folds a non-empty range without an initial value. Four independent
+/// accumulators, so the loop isn't one long dependency chain; this
+/// assumes op is associative and commutative, like std::reduce does.
+template<typename U, typename T, typename Op>
+NODISCARD_ constexpr auto reduce_nonempty_(const T* in, usize n, Op& op) -> U {
+  KTA_ASSERT(n != 0, "reduce_nonempty_ called on an empty range");
+  if(n < 8) {
+    U acc = static_cast<U>(in[0]);
+    for(usize i = 1; i < n; i++) acc = op(acc, in[i]);
+    return acc;
+  }
+
+  U a0 = static_cast<U>(in[0]), a1 = static_cast<U>(in[1]);
+  U a2 = static_cast<U>(in[2]), a3 = static_cast<U>(in[3]);
+  usize i = 4;
+  for(; i + 4 <= n; i += 4) {
+    a0 = op(a0, in[i + 0]);
+    a1 = op(a1, in[i + 1]);
+    a2 = op(a2, in[i + 2]);
+    a3 = op(a3, in[i + 3]);
+  }
+  for(; i < n; i++) a0 = op(a0, in[i]);
+  return op(op(a0, a1), op(a2, a3));
+}
+
+/// in[0] op ... op in[n - 1], strictly left to right, for ops that
+/// are associative but not commutative.
+template<typename U, typename T, typename Op>
+NODISCARD_ constexpr auto fold_nonempty_(const T* in, usize n, Op& op) -> U {
+  KTA_ASSERT(n != 0, "fold_nonempty_ called on an empty range");
+  U acc = static_cast<U>(in[0]);
+  for(usize i = 1; i < n; i++) acc = op(acc, in[i]);
+  return acc;
+}
+
+/// out[i] = acc = op(acc, in[i]). in and out may be the same array.
+template<typename U, typename T, typename Op>
+constexpr auto scan_from_(const T* in, U* out, usize n, U acc, Op& op) -> U {
+  for(usize i = 0; i < n; i++) {
+    acc    = op(acc, in[i]);
+    out[i] = acc;
+  }
+  return acc;
+}
+
+END_NAMESPACE(detail_);
+
+template<typename T, typename Fn>
+constexpr auto for_each(Span<T> range, Fn&& fn) -> void {
+  T* data = range.data();
+  for(usize i = 0; i < range.size(); i++) fn(data[i]);
+}
+
+/// Writes fn(in[i]) to out[i]; out may be in itself.
+/// Returns the part of out that was written.
+template<typename T, typename U, typename Fn>
+constexpr auto transform(Span<T> in, Span<U> out, Fn&& fn) -> Span<U> {
+  KTA_ASSERT(out.size() >= in.size(), "transform: output is too small");
+  const T* src = in.data();
+  U* dst = out.data();
+  for(usize i = 0; i < in.size(); i++) dst[i] = fn(src[i]);
+  return out.first(in.size());
+}
+
+/// Folds the range into init. The order in which elements are
+/// combined is unspecified, so op should be associative and commutative.
+template<typename T, typename U, typename Op>
+NODISCARD_ constexpr auto reduce(Span<T> range, U init, Op&& op) -> U {
+  if(range.empty()) return init;
+  return op(init, detail_::reduce_nonempty_<U>(range.data(), range.size(), op));
+}
+
+template<typename T, typename U>
+NODISCARD_ constexpr auto reduce(Span<T> range, U init) -> U {
+  return kta::reduce(range, init, detail_::Plus_{});
+}
+
+/// out[i] = in[0] op ... op in[i]. out may be in itself.
+/// Returns the part of out that was written.
+template<typename T, typename U, typename Op>
+constexpr auto inclusive_scan(Span<T> in, Span<U> out, Op&& op) -> Span<U> {
+  KTA_ASSERT(out.size() >= in.size(), "inclusive_scan: output is too small");
+  if(in.empty()) return out.first(0);
+
+  const T* src = in.data();
+  U* dst = out.data();
+  dst[0] = static_cast<U>(src[0]);
+  detail_::scan_from_(src + 1, dst + 1, in.size() - 1, dst[0], op);
+  return out.first(in.size());
+}
+
+template<typename T, typename U>
+constexpr auto inclusive_scan(Span<T> in, Span<U> out) -> Span<U> {
+  return kta::inclusive_scan(in, out, detail_::Plus_{});
+}
+
+template<typename T, typename Pred>
+NODISCARD_ constexpr auto count_if(Span<T> range, Pred&& pred) -> usize {
+  const T* data = range.data();
+  usize count = 0;
+  for(usize i = 0; i < range.size(); i++) count += static_cast<usize>(static_cast<bool>(pred(data[i])));
+  return count;
+}
+
+/*
+* Sorting.
+*
+* sort() is pattern-defeating quicksort (Orson Peters): introsort-like,
+* but it notices sorted runs and repeated keys and handles them in
+* linear time, and it shuffles elements around when a partition comes
+* out badly unbalanced. for arithmetic keys under the default
+* comparison it partitions in blocks, collecting offsets without
+* branching (BlockQuicksort, Edelkamp and Weiß), which avoids the
+* branch mispredictions that dominate plain quicksort on random data.
+*
+* stable_sort() is a bottom-up merge sort over insertion-sorted runs.
+* given a scratch span of at least half the input it merges through
+* that; otherwise it falls back to merging in place with rotations.
+*
+* radix_sort() is an LSD radix sort, one byte per pass, for integer and
+* floating point keys. it needs a scratch span as large as the input
+* and skips passes where every key has the same byte.
+*/
+
+template<typename T>
+struct Less {
+  NODISCARD_ constexpr auto operator()(const T& a, const T& b) const -> bool {
+    return a < b;
+  }
+};
+
+BEGIN_NAMESPACE(detail_);
+
+constexpr usize insertion_sort_threshold_     = 24;
+constexpr usize ninther_threshold_            = 128;
+constexpr usize partial_insertion_sort_limit_ = 8;
+constexpr usize partition_block_size_         = 64;
+
+template<typename T, typename Comp>
+constexpr auto insertion_sort_(T* begin, T* end, Comp& comp) -> void {
+  if(begin == end) return;
+  for(T* cur = begin + 1; cur != end; ++cur) {
+    T* sift   = cur;
+    T* sift_1 = cur - 1;
+    if(comp(*sift, *sift_1)) {
+      T tmp = kta::move(*sift);
+      do { *sift-- = kta::move(*sift_1); }
+      while(sift != begin && comp(tmp, *--sift_1));
+      *sift = kta::move(tmp);
+    }
+  }
+}
+
+/// Same, but assumes *(begin - 1) is no greater than anything in
+/// [begin, end), so the inner loop needs no bounds check.
+template<typename T, typename Comp>
+constexpr auto unguarded_insertion_sort_(T* begin, T* end, Comp& comp) -> void {
+  if(begin == end) return;
+  for(T* cur = begin + 1; cur != end; ++cur) {
+    T* sift   = cur;
+    T* sift_1 = cur - 1;
+    if(comp(*sift, *sift_1)) {
+      T tmp = kta::move(*sift);
+      do { *sift-- = kta::move(*sift_1); }
+      while(comp(tmp, *--sift_1));
+      *sift = kta::move(tmp);
+    }
+  }
+}
+
+/// Insertion sort that gives up once it has moved more than a few
+/// elements. Returns whether the range ended up sorted.
+template<typename T, typename Comp>
+constexpr auto partial_insertion_sort_(T* begin, T* end, Comp& comp) -> bool {
+  if(begin == end) return true;
+  usize limit = 0;
+  for(T* cur = begin + 1; cur != end; ++cur) {
+    T* sift   = cur;
+    T* sift_1 = cur - 1;
+    if(comp(*sift, *sift_1)) {
+      T tmp = kta::move(*sift);
+      do { *sift-- = kta::move(*sift_1); }
+      while(sift != begin && comp(tmp, *--sift_1));
+      *sift = kta::move(tmp);
+      limit += static_cast<usize>(cur - sift);
+    }
+    if(limit > partial_insertion_sort_limit_) return false;
+  }
+  return true;
+}
+
+template<typename T, typename Comp>
+constexpr auto sort2_(T* a, T* b, Comp& comp) -> void {
+  if(comp(*b, *a)) kta::swap(*a, *b);
+}
+
+template<typename T, typename Comp>
+constexpr auto sort3_(T* a, T* b, T* c, Comp& comp) -> void {
+  sort2_(a, b, comp);
+  sort2_(b, c, comp);
+  sort2_(a, b, comp);
+}
+
+template<typename T, typename Comp>
+constexpr auto sift_down_(T* heap, usize root, usize size, Comp& comp) -> void {
+  T value = kta::move(heap[root]);
+  for(;;) {
+    usize child = 2 * root + 1;
+    if(child >= size) break;
+    if(child + 1 < size && comp(heap[child], heap[child + 1])) ++child;
+    if(!comp(value, heap[child])) break;
+    heap[root] = kta::move(heap[child]);
+    root = child;
+  }
+  heap[root] = kta::move(value);
+}
+
+/// The fallback when quicksort keeps picking bad pivots.
+template<typename T, typename Comp>
+constexpr auto heap_sort_(T* begin, T* end, Comp& comp) -> void {
+  const usize size = static_cast<usize>(end - begin);
+  for(usize i = size / 2; i-- > 0;) sift_down_(begin, i, size, comp);
+  for(usize i = size; i-- > 1;) {
+    kta::swap(begin[0], begin[i]);
+    sift_down_(begin, 0, i, comp);
+  }
+}
+
+template<typename T>
+struct PartitionResult_ {
+  T* pivot;
+  bool already_partitioned;
+};
+
+/// Partitions around *begin into [< pivot] pivot [>= pivot].
+/// Elements equal to the pivot go right.
+template<typename T, typename Comp>
+constexpr auto partition_right_(T* begin, T* end, Comp& comp) -> PartitionResult_<T> {
+  T pivot = kta::move(*begin);
+  T* first = begin;
+  T* last  = end;
+
+  /// The median-of-3 guarantees something >= pivot on the right, and
+  /// something < pivot on the left unless this is the leftmost range.
+  while(comp(*++first, pivot));
+  if(first - 1 == begin) while(first < last && !comp(*--last, pivot));
+  else                   while(!comp(*--last, pivot));
+
+  const bool already_partitioned = first >= last;
+  while(first < last) {
+    kta::swap(*first, *last);
+    while(comp(*++first, pivot));
+    while(!comp(*--last, pivot));
+  }
+
+  T* pivot_pos = first - 1;
+  *begin     = kta::move(*pivot_pos);
+  *pivot_pos = kta::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+template<typename T>
+constexpr auto swap_offsets_(T* first, T* last, const uint8* offsets_l,
+  const uint8* offsets_r, usize num, bool use_swaps) -> void
+{
+  if(use_swaps) {
+    /// Equal counts on both sides: a cyclic permutation would leave
+    /// one element in the wrong place, plain swaps don't.
+    for(usize i = 0; i < num; i++) kta::swap(*(first + offsets_l[i]), *(last - offsets_r[i]));
+  } else if(num > 0) {
+    T* l = first + offsets_l[0];
+    T* r = last - offsets_r[0];
+    T tmp = kta::move(*l);
+    *l = kta::move(*r);
+    for(usize i = 1; i < num; i++) {
+      l  = first + offsets_l[i];
+      *r = kta::move(*l);
+      r  = last - offsets_r[i];
+      *l = kta::move(*r);
+    }
+    *r = kta::move(tmp);
+  }
+}
+
+/// partition_right_, but first records the offsets of misplaced
+/// elements a block at a time. The comparison result only feeds an
+/// index increment, so there is nothing to mispredict.
+template<typename T, typename Comp>
+constexpr auto partition_right_branchless_(T* begin, T* end, Comp& comp) -> PartitionResult_<T> {
+  T pivot = kta::move(*begin);
+  T* first = begin;
+  T* last  = end;
+
+  while(comp(*++first, pivot));
+  if(first - 1 == begin) while(first < last && !comp(*--last, pivot));
+  else                   while(!comp(*--last, pivot));
+
+  const bool already_partitioned = first >= last;
+  if(!already_partitioned) {
+    kta::swap(*first, *last);
+    ++first;
+  }
+
+  alignas(64) uint8 offsets_l[partition_block_size_];
+  alignas(64) uint8 offsets_r[partition_block_size_];
+  T* offsets_l_base = first;
+  T* offsets_r_base = last;
+  usize num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+  while(first < last) {
+    /// Fill whichever offset buffers are empty, splitting
+    /// what's left evenly if both are.
+    const usize num_unknown = static_cast<usize>(last - first);
+    const usize left_split  = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+    const usize right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+    const usize left_count = left_split >= partition_block_size_ ? partition_block_size_ : left_split;
+    for(usize i = 0; i < left_count; i++) {
+      offsets_l[num_l] = static_cast<uint8>(i);
+      num_l += !comp(*first, pivot);
+      ++first;
+    }
+
+    const usize right_count = right_split >= partition_block_size_ ? partition_block_size_ : right_split;
+    for(usize i = 0; i < right_count; i++) {
+      offsets_r[num_r] = static_cast<uint8>(i + 1);
+      num_r += comp(*--last, pivot);
+    }
+
+    const usize num = num_l < num_r ? num_l : num_r;
+    swap_offsets_(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+    num_l -= num; num_r -= num;
+    start_l += num; start_r += num;
+
+    if(num_l == 0) { start_l = 0; offsets_l_base = first; }
+    if(num_r == 0) { start_r = 0; offsets_r_base = last;  }
+  }
+
+  /// At most one side has leftovers; move them next to the middle.
+  if(num_l != 0) {
+    const uint8* offsets = offsets_l + start_l;
+    while(num_l--) kta::swap(*(offsets_l_base + offsets[num_l]), *--last);
+    first = last;
+  }
+  if(num_r != 0) {
+    const uint8* offsets = offsets_r + start_r;
+    while(num_r--) { kta::swap(*(offsets_r_base - offsets[num_r]), *first); ++first; }
+    last = first;
+  }
+
+  T* pivot_pos = first - 1;
+  *begin     = kta::move(*pivot_pos);
+  *pivot_pos = kta::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+/// Partitions around *begin into [<= pivot] pivot [> pivot]. Used when
+/// the pivot equals the element before the range: everything equal to it
+/// lands on the left and is done with, so repeated keys cost linear time.
+template<typename T, typename Comp>
+constexpr auto partition_left_(T* begin, T* end, Comp& comp) -> T* {
+  T pivot = kta::move(*begin);
+  T* first = begin;
+  T* last  = end;
+
+  while(comp(pivot, *--last));
+  if(last + 1 == end) while(first < last && !comp(pivot, *++first));
+  else                while(!comp(pivot, *++first));
+
+  while(first < last) {
+    kta::swap(*first, *last);
+    while(comp(pivot, *--last));
+    while(!comp(pivot, *++first));
+  }
+
+  T* pivot_pos = last;
+  *begin     = kta::move(*pivot_pos);
+  *pivot_pos = kta::move(pivot);
+  return pivot_pos;
+}
+
+/// Median of 3, or pseudo-median of 9 for larger ranges,
+/// left in *begin as the pivot.
+template<typename T, typename Comp>
+constexpr auto choose_pivot_(T* begin, T* end, Comp& comp) -> void {
+  const usize size = static_cast<usize>(end - begin);
+  const usize s2   = size / 2;
+  if(size > ninther_threshold_) {
+    sort3_(begin, begin + s2, end - 1, comp);
+    sort3_(begin + 1, begin + (s2 - 1), end - 2, comp);
+    sort3_(begin + 2, begin + (s2 + 1), end - 3, comp);
+    sort3_(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+    kta::swap(*begin, *(begin + s2));
+  } else {
+    sort3_(begin + s2, begin, end - 1, comp);
+  }
+}
+
+template<bool branchless_, typename T, typename Comp>
+constexpr auto pdqsort_loop_(T* begin, T* end, Comp& comp, int bad_allowed, bool leftmost) -> void {
+  for(;;) {
+    const usize size = static_cast<usize>(end - begin);
+    if(size < insertion_sort_threshold_) {
+      if(leftmost) insertion_sort_(begin, end, comp);
+      else unguarded_insertion_sort_(begin, end, comp);
+      return;
+    }
+
+    choose_pivot_(begin, end, comp);
+
+    /// The element before us came from an earlier pivot, so it's <=
+    /// everything here. If it's also >= our pivot, they're equal.
+    if(!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = partition_left_(begin, end, comp) + 1;
+      continue;
+    }
+
+    const PartitionResult_<T> part = branchless_
+      ? partition_right_branchless_(begin, end, comp)
+      : partition_right_(begin, end, comp);
+
+    T* pivot_pos = part.pivot;
+    const usize l_size = static_cast<usize>(pivot_pos - begin);
+    const usize r_size = static_cast<usize>(end - (pivot_pos + 1));
+    const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+    if(highly_unbalanced) {
+      if(--bad_allowed == 0) {
+        heap_sort_(begin, end, comp);
+        return;
+      }
+
+      /// Break up whatever pattern got us here.
+      if(l_size >= insertion_sort_threshold_) {
+        kta::swap(*begin, *(begin + l_size / 4));
+        kta::swap(*(pivot_pos - 1), *(pivot_pos - l_size / 4));
+        if(l_size > ninther_threshold_) {
+          kta::swap(*(begin + 1), *(begin + (l_size / 4 + 1)));
+          kta::swap(*(begin + 2), *(begin + (l_size / 4 + 2)));
+          kta::swap(*(pivot_pos - 2), *(pivot_pos - (l_size / 4 + 1)));
+          kta::swap(*(pivot_pos - 3), *(pivot_pos - (l_size / 4 + 2)));
+        }
+      }
+
+      if(r_size >= insertion_sort_threshold_) {
+        kta::swap(*(pivot_pos + 1), *(pivot_pos + (1 + r_size / 4)));
+        kta::swap(*(end - 1), *(end - r_size / 4));
+        if(r_size > ninther_threshold_) {
+          kta::swap(*(pivot_pos + 2), *(pivot_pos + (2 + r_size / 4)));
+          kta::swap(*(pivot_pos + 3), *(pivot_pos + (3 + r_size / 4)));
+          kta::swap(*(end - 2), *(end - (1 + r_size / 4)));
+          kta::swap(*(end - 3), *(end - (2 + r_size / 4)));
+        }
+      }
+    } else if(part.already_partitioned
+      && partial_insertion_sort_(begin, pivot_pos, comp)
+      && partial_insertion_sort_(pivot_pos + 1, end, comp)) {
+      /// Nothing was out of place, so this was probably sorted already.
+      return;
+    }
+
+    /// Recurse on the left, loop on the right.
+    pdqsort_loop_<branchless_>(begin, pivot_pos, comp, bad_allowed, leftmost);
+    begin    = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+template<typename T, typename Comp>
+inline constexpr bool sort_branchless_ =
+  (IsIntegral<T> || IsFloatingPoint<T>) && IsSame<Decay<Comp>, Less<T>>;
+
+/// Reverses [begin, end).
+template<typename T>
+constexpr auto reverse_(T* begin, T* end) -> void {
+  while(begin < end && begin < --end) kta::swap(*begin++, *end);
+}
+
+/// [begin, mid) [mid, end) -> [mid, end) [begin, mid).
+template<typename T>
+constexpr auto rotate_(T* begin, T* mid, T* end) -> void {
+  reverse_(begin, mid);
+  reverse_(mid, end);
+  reverse_(begin, end);
+}
+
+/// Branchless binary search (Khuong and Morin, "Array Layouts for
+/// Comparison-Based Searching"). The loop always runs log2(n) times
+/// and the comparison only selects the next base, which compiles to a
+/// conditional move instead of an unpredictable branch. Both possible
+/// next probes are prefetched, which hides most of the miss latency
+/// once the array no longer fits in cache.
+template<typename T, typename U, typename Comp>
+NODISCARD_ constexpr auto lower_bound_(T* begin, T* end, const U& value, Comp& comp) -> T* {
+  usize len = static_cast<usize>(end - begin);
+  if(len == 0) return begin;
+  while(len > 1) {
+    const usize half = len / 2;
+    if !consteval {
+      __builtin_prefetch(begin + half / 2);
+      __builtin_prefetch(begin + half + half / 2);
+    }
+    begin = comp(begin[half], value) ? begin + half : begin;
+    len  -= half;
+  }
+  return begin + static_cast<usize>(comp(*begin, value));
+}
+
+template<typename T, typename U, typename Comp>
+NODISCARD_ constexpr auto upper_bound_(T* begin, T* end, const U& value, Comp& comp) -> T* {
+  usize len = static_cast<usize>(end - begin);
+  if(len == 0) return begin;
+  while(len > 1) {
+    const usize half = len / 2;
+    if !consteval {
+      __builtin_prefetch(begin + half / 2);
+      __builtin_prefetch(begin + half + half / 2);
+    }
+    begin = comp(value, begin[half]) ? begin : begin + half;
+    len  -= half;
+  }
+  return begin + static_cast<usize>(!comp(value, *begin));
+}
+
+/// Stable merge of two adjacent sorted runs without extra memory,
+/// O(n log n) moves per merge.
+template<typename T, typename Comp>
+constexpr auto merge_in_place_(T* begin, T* mid, T* end, Comp& comp) -> void {
+  const usize len1 = static_cast<usize>(mid - begin);
+  const usize len2 = static_cast<usize>(end - mid);
+  if(len1 == 0 || len2 == 0) return;
+  if(len1 + len2 == 2) {
+    if(comp(*mid, *begin)) kta::swap(*begin, *mid);
+    return;
+  }
+
+  T* cut1;
+  T* cut2;
+  if(len1 > len2) {
+    cut1 = begin + len1 / 2;
+    cut2 = lower_bound_(mid, end, *cut1, comp);
+  } else {
+    cut2 = mid + len2 / 2;
+    cut1 = upper_bound_(begin, mid, *cut2, comp);
+  }
+
+  rotate_(cut1, mid, cut2);
+  T* new_mid = cut1 + (cut2 - mid);
+  merge_in_place_(begin, cut1, new_mid, comp);
+  merge_in_place_(new_mid, cut2, end, comp);
+}
+
+/// Moves the shorter run out into the buffer, then merges back into
+/// place: forwards if it was the left one, backwards otherwise.
+template<typename T, typename Comp>
+constexpr auto merge_buffered_(T* begin, T* mid, T* end, T* buffer, Comp& comp) -> void {
+  if(mid - begin <= end - mid) {
+    T* buf_end = buffer;
+    for(T* p = begin; p != mid; ++p) *buf_end++ = kta::move(*p);
+
+    T* out   = begin;
+    T* left  = buffer;
+    T* right = mid;
+    while(left != buf_end && right != end) {
+      /// Ties take from the left run, which is what keeps this stable.
+      if(comp(*right, *left)) *out++ = kta::move(*right++);
+      else                    *out++ = kta::move(*left++);
+    }
+    while(left != buf_end) *out++ = kta::move(*left++);
+  } else {
+    T* buf_end = buffer;
+    for(T* p = mid; p != end; ++p) *buf_end++ = kta::move(*p);
+
+    T* out   = end;
+    T* left  = mid;
+    T* right = buf_end;
+    while(left != begin && right != buffer) {
+      /// Going backwards, ties take from the right run.
+      if(comp(*(right - 1), *(left - 1))) *--out = kta::move(*--left);
+      else                                *--out = kta::move(*--right);
+    }
+    while(right != buffer) *--out = kta::move(*--right);
+  }
+}
+
+constexpr usize stable_run_size_ = 32;
+
+END_NAMESPACE(detail_);
+
+/// Unstable sort. O(n log n) worst case, linear on sorted,
+/// reverse-sorted and all-equal input.
+template<typename T, typename Comp = Less<T>>
+constexpr auto sort(Span<T> range, Comp&& comp = Comp{}) -> void {
+  const usize size = range.size();
+  if(size < 2) return;
+
+  int bad_allowed = 0;
+  for(usize n = size; n > 1; n >>= 1) ++bad_allowed;
+
+  T* begin = range.data();
+  detail_::pdqsort_loop_<detail_::sort_branchless_<T, Comp>>(begin, begin + size, comp, bad_allowed, true);
+}
+
+/// Stable sort. scratch should hold at least (size + 1) / 2 elements;
+/// its contents are clobbered. With less than that it still works,
+/// merging in place, but more slowly.
+template<typename T, typename Comp = Less<T>>
+constexpr auto stable_sort(Span<T> range, Span<T> scratch, Comp&& comp = Comp{}) -> void {
+  const usize size = range.size();
+  if(size < 2) return;
+
+  T* begin = range.data();
+  for(usize lo = 0; lo < size; lo += detail_::stable_run_size_) {
+    const usize hi = lo + detail_::stable_run_size_ < size ? lo + detail_::stable_run_size_ : size;
+    detail_::insertion_sort_(begin + lo, begin + hi, comp);
+  }
+
+  for(usize width = detail_::stable_run_size_; width < size; width *= 2) {
+    for(usize lo = 0; lo + width < size; lo += 2 * width) {
+      T* mid = begin + lo + width;
+      T* hi  = begin + (lo + 2 * width < size ? lo + 2 * width : size);
+
+      /// Runs that are already in order need no merge at all.
+      if(!comp(*mid, *(mid - 1))) continue;
+      const usize shorter = static_cast<usize>(hi - mid) < width ? static_cast<usize>(hi - mid) : width;
+      if(scratch.size() >= shorter) detail_::merge_buffered_(begin + lo, mid, hi, scratch.data(), comp);
+      else detail_::merge_in_place_(begin + lo, mid, hi, comp);
+    }
+  }
+}
+
+template<typename T, typename Comp = Less<T>>
+constexpr auto stable_sort(Span<T> range, Comp&& comp = Comp{}) -> void {
+  kta::stable_sort(range, Span<T>(), comp);
+}
+
+/// Index of the first element not less than value, or size() if none.
+template<typename T, typename U, typename Comp = Less<RemoveCV<T>>>
+NODISCARD_ constexpr auto lower_bound(Span<T> range, const U& value, Comp&& comp = Comp{}) -> usize {
+  T* begin = range.data();
+  return static_cast<usize>(detail_::lower_bound_(begin, begin + range.size(), value, comp) - begin);
+}
+
+/// Index of the first element greater than value, or size() if none.
+template<typename T, typename U, typename Comp = Less<RemoveCV<T>>>
+NODISCARD_ constexpr auto upper_bound(Span<T> range, const U& value, Comp&& comp = Comp{}) -> usize {
+  T* begin = range.data();
+  return static_cast<usize>(detail_::upper_bound_(begin, begin + range.size(), value, comp) - begin);
+}
+
+template<typename T, typename U, typename Comp = Less<RemoveCV<T>>>
+NODISCARD_ constexpr auto binary_search(Span<T> range, const U& value, Comp&& comp = Comp{}) -> bool {
+  const usize index = kta::lower_bound(range, value, comp);
+  return index < range.size() && !comp(value, range.data()[index]);
+}
+
+BEGIN_NAMESPACE(detail_);
+
+template<usize size_> struct RadixBits_;
+template<> struct RadixBits_<1> { using Type = uint8;  };
+template<> struct RadixBits_<2> { using Type = uint16; };
+template<> struct RadixBits_<4> { using Type = uint32; };
+template<> struct RadixBits_<8> { using Type = uint64; };
+
+/// Maps a key to an unsigned integer with the same ordering:
+/// flip the sign bit of signed integers; for floats, flip every
+/// bit of negatives and just the sign bit of positives.
+template<typename T>
+NODISCARD_ constexpr auto radix_key_(T value) {
+  using Bits = typename RadixBits_<sizeof(T)>::Type;
+  constexpr Bits sign = static_cast<Bits>(Bits(1) << (sizeof(T) * 8 - 1));
+
+  const Bits bits = __builtin_bit_cast(Bits, value);
+  if constexpr(IsFloatingPoint<T>) {
+    const Bits mask = (bits & sign) != 0 ? static_cast<Bits>(~Bits(0)) : sign;
+    return static_cast<Bits>(bits ^ mask);
+  } else if constexpr(static_cast<T>(-1) < static_cast<T>(0)) {
+    return static_cast<Bits>(bits ^ sign);
+  } else {
+    return bits;
+  }
+}
+
+END_NAMESPACE(detail_);
+
+template<typename T>
+concept RadixSortable = (IsIntegral<T> || IsFloatingPoint<T>)
+  && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// Sorts keys in ascending order. scratch must be at least as large
+/// as keys; its contents are clobbered. Floats sort by their bit
+/// pattern: -0.0 before 0.0, NaNs at the ends according to their sign.
+template<RadixSortable T>
+auto radix_sort(Span<T> keys, Span<T> scratch) -> void {
+  KTA_ASSERT(scratch.size() >= keys.size(), "radix_sort: scratch is too small");
+  constexpr usize passes = sizeof(T);
+  const usize size = keys.size();
+  if(size < 2) return;
+
+  /// Histograms for every pass in one sweep over the input.
+  usize counts[passes][256] = {};
+  const T* in = keys.data();
+  for(usize i = 0; i < size; i++) {
+    const auto key = detail_::radix_key_(in[i]);
+    for(usize pass = 0; pass < passes; pass++) ++counts[pass][(key >> (pass * 8)) & 0xFF];
+  }
+
+  T* src = keys.data();
+  T* dst = scratch.data();
+  for(usize pass = 0; pass < passes; pass++) {
+    usize* count = counts[pass];
+    const auto first_key = detail_::radix_key_(src[0]);
+    if(count[(first_key >> (pass * 8)) & 0xFF] == size) continue;
+
+    usize offsets[256];
+    usize sum = 0;
+    for(usize digit = 0; digit < 256; digit++) {
+      offsets[digit] = sum;
+      sum += count[digit];
+    }
+
+    for(usize i = 0; i < size; i++) {
+      const auto key = detail_::radix_key_(src[i]);
+      dst[offsets[(key >> (pass * 8)) & 0xFF]++] = src[i];
+    }
+
+    T* tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+
+  if(src != keys.data()) {
+    for(usize i = 0; i < size; i++) keys.data()[i] = src[i];
+  }
+}
+
+/*
+* Reductions: min_element, max_element, minmax, sum and count.
+*
+* for integer and floating point elements these run explicit vector
+* kernels rather than trusting the auto-vectorizer, which doesn't run at
+* all at -O0 and gives up on floating point reductions without
+* -ffast-math. each kernel is written once over GCC vector extensions,
+* with the width as a parameter. on x86_64 it is instantiated at 32
+* bytes for AVX2, picked through CPUID, and at 16 bytes otherwise,
+* since SSE2 is always there. elsewhere the 16 byte version lowers to
+* whatever the target has. other element types take a plain loop.
+*
+* float sums are added up lane by lane, so they can round differently
+* from a left-to-right sum. NaNs give unspecified extrema.
+*/
+
+template<typename T>
+struct MinMax {
+  T min;
+  T max;
+};
+
+BEGIN_NAMESPACE(detail_);
+
+template<typename T>
+concept SimdElement_ = !IsSame<RemoveCV<T>, bool>
+  && (IsIntegral<T> || IsFloatingPoint<T>)
+  && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template<typename T>
+struct SumType_ { using Type = T; };
+
+template<Integer T> requires (static_cast<T>(-1) < static_cast<T>(0))
+struct SumType_<T> { using Type = int64; };
+
+template<Integer T> requires (static_cast<T>(-1) > static_cast<T>(0))
+struct SumType_<T> { using Type = uint64; };
+
+END_NAMESPACE(detail_);
+
+/// Integers are summed in 64 bits (wrapping), anything else in its own type.
+template<typename T>
+using SumType = typename detail_::SumType_<RemoveCV<T>>::Type;
+
+BEGIN_NAMESPACE(detail_);
+
+/// GCC drops vector_size on a dependent alias, but not on a typedef
+/// inside a class template.
+template<typename T, usize width_>
+struct VecOf_ {
+  typedef T Type __attribute__((vector_size(width_)));
+};
+
+/// The kernels keep vectors out of their signatures: they're always
+/// inlined into a wrapper compiled for the right target, and a 32 byte
+/// vector crossing a non-AVX function boundary would change the ABI.
+template<usize width_, bool min_, bool max_, typename T>
+FORCEINLINE_ auto extremes_kernel_(const T* data, usize n) -> MinMax<T> {
+  using Vec = typename VecOf_<T, width_>::Type;
+  constexpr usize lanes = width_ / sizeof(T);
+
+  MinMax<T> result{data[0], data[0]};
+  usize i = 0;
+  if(n >= 2 * lanes) {
+    Vec lo0, lo1;
+    __builtin_memcpy(&lo0, data, width_);
+    __builtin_memcpy(&lo1, data + lanes, width_);
+    Vec hi0 = lo0, hi1 = lo1;
+
+    for(i = 2 * lanes; i + 2 * lanes <= n; i += 2 * lanes) {
+      Vec a, b;
+      __builtin_memcpy(&a, data + i, width_);
+      __builtin_memcpy(&b, data + i + lanes, width_);
+      if constexpr(min_) { lo0 = a < lo0 ? a : lo0; lo1 = b < lo1 ? b : lo1; }
+      if constexpr(max_) { hi0 = hi0 < a ? a : hi0; hi1 = hi1 < b ? b : hi1; }
+    }
+
+    /// The side nobody asked for was never updated, so don't fold it either.
+    if constexpr(min_) {
+      lo0 = lo1 < lo0 ? lo1 : lo0;
+      result.min = lo0[0];
+      for(usize lane = 1; lane < lanes; lane++) {
+        if(lo0[lane] < result.min) result.min = lo0[lane];
+      }
+    }
+    if constexpr(max_) {
+      hi0 = hi0 < hi1 ? hi1 : hi0;
+      result.max = hi0[0];
+      for(usize lane = 1; lane < lanes; lane++) {
+        if(result.max < hi0[lane]) result.max = hi0[lane];
+      }
+    }
+  }
+
+  for(; i < n; i++) {
+    if constexpr(min_) { if(data[i] < result.min) result.min = data[i]; }
+    if constexpr(max_) { if(result.max < data[i]) result.max = data[i]; }
+  }
+  return result;
+}
+
+template<usize width_, typename T>
+FORCEINLINE_ auto sum_kernel_(const T* data, usize n) -> SumType<T> {
+  using S   = SumType<T>;
+  using Acc = typename VecOf_<S, width_>::Type;
+  constexpr usize lanes = width_ / sizeof(S);
+  using Vec = typename VecOf_<T, lanes * sizeof(T)>::Type;
+
+  /// Narrow integers are widened to 64 bits as they are loaded. Only
+  /// as many as fill one register get loaded at a time: a wider
+  /// accumulator doesn't fit in a register and ends up on the stack.
+  Acc acc0 = {}, acc1 = {};
+  usize i = 0;
+  for(; i + 2 * lanes <= n; i += 2 * lanes) {
+    Vec a, b;
+    __builtin_memcpy(&a, data + i, sizeof(Vec));
+    __builtin_memcpy(&b, data + i + lanes, sizeof(Vec));
+    acc0 += __builtin_convertvector(a, Acc);
+    acc1 += __builtin_convertvector(b, Acc);
+  }
+
+  acc0 += acc1;
+  S total = 0;
+  for(usize lane = 0; lane < lanes; lane++) total += acc0[lane];
+  for(; i < n; i++) total += static_cast<S>(data[i]);
+  return total;
+}
+
+template<usize width_, typename T>
+FORCEINLINE_ auto count_kernel_(const T* data, usize n, T value) -> usize {
+  using Vec  = typename VecOf_<T, width_>::Type;
+  using Mask = decltype(Vec{} == Vec{});
+  constexpr usize lanes = width_ / sizeof(T);
+
+  /// Lanes count matches by subtracting the -1 compare masks. Narrow
+  /// lanes are flushed before they could overflow.
+  constexpr usize flush_every = sizeof(T) == 1 ? 127 : sizeof(T) == 2 ? 32767 : usize(1) << 30;
+
+  const Vec needle = Vec{} + value;
+  usize count = 0;
+  usize i = 0;
+  while(i + lanes <= n) {
+    usize blocks = (n - i) / lanes;
+    if(blocks > flush_every) blocks = flush_every;
+
+    Mask acc = {};
+    for(usize block = 0; block < blocks; block++, i += lanes) {
+      Vec a;
+      __builtin_memcpy(&a, data + i, width_);
+      acc -= a == needle;
+    }
+    for(usize lane = 0; lane < lanes; lane++) count += static_cast<usize>(acc[lane]);
+  }
+
+  for(; i < n; i++) count += static_cast<usize>(data[i] == value);
+  return count;
+}
+
+/// Index of the first element equal to value, or n.
+template<usize width_, typename T>
+FORCEINLINE_ auto find_kernel_(const T* data, usize n, T value) -> usize {
+  using Vec  = typename VecOf_<T, width_>::Type;
+  using Mask = decltype(Vec{} == Vec{});
+  constexpr usize lanes = width_ / sizeof(T);
+
+  const Vec needle = Vec{} + value;
+  usize i = 0;
+  for(; i + lanes <= n; i += lanes) {
+    Vec a;
+    __builtin_memcpy(&a, data + i, width_);
+    const Mask hits = a == needle;
+
+    uint64 words[width_ / 8];
+    __builtin_memcpy(words, &hits, width_);
+    uint64 any = 0;
+    for(usize w = 0; w < width_ / 8; w++) any |= words[w];
+    if(any != 0) break;
+  }
+
+  for(; i < n; i++) {
+    if(data[i] == value) return i;
+  }
+  return n;
+}
+
+#  if defined(ARCH_X86_64)
+template<bool min_, bool max_, typename T>
+KTA_TARGET_AVX2_ auto extremes_avx2_(const T* data, usize n) -> MinMax<T> {
+  return extremes_kernel_<32, min_, max_>(data, n);
+}
+
+template<typename T>
+KTA_TARGET_AVX2_ auto sum_avx2_(const T* data, usize n) -> SumType<T> {
+  return sum_kernel_<32>(data, n);
+}
+
+template<typename T>
+KTA_TARGET_AVX2_ auto count_avx2_(const T* data, usize n, T value) -> usize {
+  return count_kernel_<32>(data, n, value);
+}
+
+template<typename T>
+KTA_TARGET_AVX2_ auto find_avx2_(const T* data, usize n, T value) -> usize {
+  return find_kernel_<32>(data, n, value);
+}
+#  endif
+
+template<bool min_, bool max_, typename T>
+NODISCARD_ auto extremes_(const T* data, usize n) -> MinMax<T> {
+#  if defined(ARCH_X86_64)
+  if(simd_tier() >= SimdTier::Avx2) return extremes_avx2_<min_, max_>(data, n);
+#  endif
+  return extremes_kernel_<16, min_, max_>(data, n);
+}
+
+template<typename T>
+NODISCARD_ auto sum_(const T* data, usize n) -> SumType<T> {
+#  if defined(ARCH_X86_64)
+  if(simd_tier() >= SimdTier::Avx2) return sum_avx2_(data, n);
+#  endif
+  return sum_kernel_<16>(data, n);
+}
+
+template<typename T>
+NODISCARD_ auto count_(const T* data, usize n, T value) -> usize {
+#  if defined(ARCH_X86_64)
+  if(simd_tier() >= SimdTier::Avx2) return count_avx2_(data, n, value);
+#  endif
+  return count_kernel_<16>(data, n, value);
+}
+
+template<typename T>
+NODISCARD_ auto find_(const T* data, usize n, T value) -> usize {
+#  if defined(ARCH_X86_64)
+  if(simd_tier() >= SimdTier::Avx2) return find_avx2_(data, n, value);
+#  endif
+  return find_kernel_<16>(data, n, value);
+}
+
+END_NAMESPACE(detail_);
+
+/// Index of the first smallest element, or size() if the span is empty.
+template<typename T>
+NODISCARD_ auto min_element(Span<T> range) -> usize {
+  using Value = RemoveCV<T>;
+  const Value* data = range.data();
+  const usize n = range.size();
+  if(n == 0) return 0;
+
+  if constexpr(detail_::SimdElement_<Value>) {
+    const Value min = detail_::extremes_<true, false>(data, n).min;
+    const usize index = detail_::find_(data, n, min);
+    return index < n ? index : 0;
+  } else {
+    usize best = 0;
+    for(usize i = 1; i < n; i++) {
+      if(data[i] < data[best]) best = i;
+    }
+    return best;
+  }
+}
+
+/// Index of the first largest element, or size() if the span is empty.
+template<typename T>
+NODISCARD_ auto max_element(Span<T> range) -> usize {
+  using Value = RemoveCV<T>;
+  const Value* data = range.data();
+  const usize n = range.size();
+  if(n == 0) return 0;
+
+  if constexpr(detail_::SimdElement_<Value>) {
+    const Value max = detail_::extremes_<false, true>(data, n).max;
+    const usize index = detail_::find_(data, n, max);
+    return index < n ? index : 0;
+  } else {
+    usize best = 0;
+    for(usize i = 1; i < n; i++) {
+      if(data[best] < data[i]) best = i;
+    }
+    return best;
+  }
+}
+
+/// The smallest and largest values, in a single pass.
+template<typename T>
+NODISCARD_ auto minmax(Span<T> range) -> Option<MinMax<RemoveCV<T>>> {
+  using Value = RemoveCV<T>;
+  const Value* data = range.data();
+  const usize n = range.size();
+  if(n == 0) return {};
+
+  if constexpr(detail_::SimdElement_<Value>) {
+    return detail_::extremes_<true, true>(data, n);
+  } else {
+    MinMax<Value> result{data[0], data[0]};
+    for(usize i = 1; i < n; i++) {
+      if(data[i] < result.min) result.min = data[i];
+      if(result.max < data[i]) result.max = data[i];
+    }
+    return result;
+  }
+}
+
+template<typename T>
+NODISCARD_ auto sum(Span<T> range) -> SumType<T> {
+  using Value = RemoveCV<T>;
+  if constexpr(detail_::SimdElement_<Value>) {
+    return detail_::sum_(range.data(), range.size());
+  } else {
+    return kta::reduce(range, SumType<T>{});
+  }
+}
+
+/// Number of elements equal to value.
+template<typename T>
+NODISCARD_ auto count(Span<T> range, const RemoveCV<T>& value) -> usize {
+  using Value = RemoveCV<T>;
+  if constexpr(detail_::SimdElement_<Value>) {
+    return detail_::count_(range.data(), range.size(), value);
+  } else {
+    return kta::count_if(range, [&value](const Value& elem) { return elem == value; });
+  }
+}
+
 END_NAMESPACE_KTA_
@@ -0,0 +1,262 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/CpuHints.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Meta/TypeTraits.hpp>
+
+#  ifdef KTA_ASSUME_TESTING_ENV_
+#  if defined(KTA_BUILD_PLATFORM_LINUX)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define KTA_HAS_FUTEX_
+#  endif //defined(KTA_BUILD_PLATFORM_LINUX)
+
+#  if defined(KTA_BUILD_PLATFORM_POSIX)
+#include <sched.h>
+#define KTA_HAS_SCHED_YIELD_
+#  endif //defined(KTA_BUILD_PLATFORM_POSIX)
+#  endif //KTA_ASSUME_TESTING_ENV_
+BEGIN_NAMESPACE_KTA_
+
+/*
+* A freestanding atomic layer built directly on the __atomic builtins.
+* we can't use <atomic> outside of the testing environment, and the
+* builtins are what it boils down to anyway.
+*
+* blocking waits use a futex where we have one (the Linux testing
+* environment). everywhere else, wait() spins with exponential backoff
+* and then yields, and notify_*() has nothing to do.
+*/
+
+enum class MemoryOrder : int {
+  Relaxed = __ATOMIC_RELAXED,
+  Consume = __ATOMIC_CONSUME,
+  Acquire = __ATOMIC_ACQUIRE,
+  Release = __ATOMIC_RELEASE,
+  AcqRel  = __ATOMIC_ACQ_REL,
+  SeqCst  = __ATOMIC_SEQ_CST,
+};
+
+template<typename T>
+concept AtomicCapable = IsTriviallyCopyable<T>
+  && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+FORCEINLINE_ auto atomic_thread_fence(MemoryOrder order) -> void {
+  __atomic_thread_fence(static_cast<int>(order));
+}
+
+/// Compiler-only barrier, orders nothing at the hardware level.
+FORCEINLINE_ auto atomic_signal_fence(MemoryOrder order) -> void {
+  __atomic_signal_fence(static_cast<int>(order));
+}
+
+/// Give up the rest of our timeslice, if there is anyone to give it to.
+FORCEINLINE_ auto thread_yield() -> void {
+#  if defined(KTA_HAS_SCHED_YIELD_)
+  ::sched_yield();
+#  else
+  cpu_relax();
+#  endif
+}
+
+/// Exponential backoff for spin loops: pause for 1, 2, 4 ... 64
+/// iterations, then start yielding.
+class Backoff {
+public:
+  auto spin() -> void {
+    if(step_ <= spin_limit_) {
+      for(uint32 i = 0; i < (1u << step_); i++) cpu_relax();
+      ++step_;
+    } else {
+      thread_yield();
+    }
+  }
+
+  NODISCARD_ auto is_yielding() const -> bool { return step_ > spin_limit_; }
+  auto reset() -> void { step_ = 0; }
+private:
+  constexpr static uint32 spin_limit_ = 6;
+  uint32 step_ = 0;
+};
+
+BEGIN_NAMESPACE(detail_);
+
+#  if defined(KTA_HAS_FUTEX_)
+inline auto futex_wait_(const void* addr, uint32 expected) -> void {
+  ::syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+inline auto futex_wake_(const void* addr, int count) -> void {
+  ::syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+#  else
+/// Never called (uses_futex_ is false), but the calls below still have to name something.
+inline auto futex_wait_(const void*, uint32) -> void {}
+inline auto futex_wake_(const void*, int) -> void {}
+#  endif //defined(KTA_HAS_FUTEX_)
+
+/// The futex only compares 32 bits. Waiting on part of a
+/// larger value could miss a wakeup, so those always poll.
+template<typename T>
+inline constexpr bool uses_futex_ =
+#  if defined(KTA_HAS_FUTEX_)
+  sizeof(T) == 4;
+#  else
+  false;
+#  endif
+
+END_NAMESPACE(detail_);
+
+template<AtomicCapable T>
+class Atomic {
+  KTA_MAKE_NONCOPYABLE(Atomic);
+public:
+  using ValueType = T;
+
+  static constexpr bool is_always_lock_free = __atomic_always_lock_free(sizeof(T), 0);
+
+  NODISCARD_ FORCEINLINE_ auto load(MemoryOrder order = MemoryOrder::SeqCst) const -> T {
+    T out;
+    __atomic_load(&value_, &out, static_cast<int>(order));
+    return out;
+  }
+
+  FORCEINLINE_ auto store(T value, MemoryOrder order = MemoryOrder::SeqCst) -> void {
+    __atomic_store(&value_, &value, static_cast<int>(order));
+  }
+
+  FORCEINLINE_ auto exchange(T value, MemoryOrder order = MemoryOrder::SeqCst) -> T {
+    T out;
+    __atomic_exchange(&value_, &value, &out, static_cast<int>(order));
+    return out;
+  }
+
+  /// On failure, expected receives the current value.
+  FORCEINLINE_ auto compare_exchange_weak(
+    T& expected,
+    T desired,
+    MemoryOrder success = MemoryOrder::SeqCst,
+    MemoryOrder failure = MemoryOrder::Relaxed ) -> bool
+  {
+    return __atomic_compare_exchange(&value_, &expected, &desired, true,
+      static_cast<int>(success), static_cast<int>(failure));
+  }
+
+  FORCEINLINE_ auto compare_exchange_strong(
+    T& expected,
+    T desired,
+    MemoryOrder success = MemoryOrder::SeqCst,
+    MemoryOrder failure = MemoryOrder::Relaxed ) -> bool
+  {
+    return __atomic_compare_exchange(&value_, &expected, &desired, false,
+      static_cast<int>(success), static_cast<int>(failure));
+  }
+
+  FORCEINLINE_ auto fetch_add(T value, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Integer<T> {
+    return __atomic_fetch_add(&value_, value, static_cast<int>(order));
+  }
+
+  FORCEINLINE_ auto fetch_sub(T value, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Integer<T> {
+    return __atomic_fetch_sub(&value_, value, static_cast<int>(order));
+  }
+
+  FORCEINLINE_ auto fetch_and(T value, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Integer<T> {
+    return __atomic_fetch_and(&value_, value, static_cast<int>(order));
+  }
+
+  FORCEINLINE_ auto fetch_or(T value, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Integer<T> {
+    return __atomic_fetch_or(&value_, value, static_cast<int>(order));
+  }
+
+  FORCEINLINE_ auto fetch_xor(T value, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Integer<T> {
+    return __atomic_fetch_xor(&value_, value, static_cast<int>(order));
+  }
+
+  /// The builtins do byte arithmetic on pointers, we scale by the pointee size.
+  FORCEINLINE_ auto fetch_add(ptrdiff delta, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Pointer<T> {
+    return __atomic_fetch_add(&value_, delta * static_cast<ptrdiff>(sizeof(RemovePointer<T>)), static_cast<int>(order));
+  }
+
+  FORCEINLINE_ auto fetch_sub(ptrdiff delta, MemoryOrder order = MemoryOrder::SeqCst) -> T requires Pointer<T> {
+    return __atomic_fetch_sub(&value_, delta * static_cast<ptrdiff>(sizeof(RemovePointer<T>)), static_cast<int>(order));
+  }
+
+  /// Blocks until the value is observed to differ from old. A change
+  /// that is reverted before we get to look may go unnoticed (ABA).
+  auto wait(T old, MemoryOrder order = MemoryOrder::SeqCst) const -> void {
+    Backoff backoff;
+    while(equals_(load(order), old)) {
+      if constexpr(detail_::uses_futex_<T>) {
+        if(backoff.is_yielding()) {
+          uint32 expected;
+          __builtin_memcpy(&expected, &old, sizeof(expected));
+          detail_::futex_wait_(&value_, expected);
+          continue;
+        }
+      }
+
+      backoff.spin();
+    }
+  }
+
+  /// Wakes threads blocked in wait(). Costs a system call where
+  /// waits block, so don't call it for values nobody waits on.
+  auto notify_one() -> void {
+    if constexpr(detail_::uses_futex_<T>) detail_::futex_wake_(&value_, 1);
+  }
+
+  auto notify_all() -> void {
+    if constexpr(detail_::uses_futex_<T>) detail_::futex_wake_(&value_, __INT_MAX__);
+  }
+
+  constexpr explicit Atomic(T value) : value_(value) {}
+  constexpr Atomic() = default;
+private:
+  /// Compare object representations, T need not have an operator==.
+  NODISCARD_ static auto equals_(const T& a, const T& b) -> bool {
+    return __builtin_memcmp(&a, &b, sizeof(T)) == 0;
+  }
+
+  alignas(sizeof(T)) T value_{};
+};
+
+/// Places a value on its own cache line(s), so that writes to
+/// it don't invalidate whatever would otherwise sit next to it.
+template<typename T>
+struct alignas(cache_line_size) CachePadded {
+  T value;
+
+  NODISCARD_ constexpr auto operator->(this auto&& self) -> decltype(auto) {
+    return &kta::forward<decltype(self)>(self).value;
+  }
+
+  NODISCARD_ constexpr auto operator*(this auto&& self) -> decltype(auto) {
+    return (kta::forward<decltype(self)>(self).value);
+  }
+
+  template<typename ...Args>
+  constexpr explicit CachePadded(Args&&... args) : value(kta::forward<Args>(args)...) {}
+};
+
+/// An Atomic<T> that owns its cache line.
+template<AtomicCapable T>
+class alignas(cache_line_size) PaddedAtomic : public Atomic<T> {
+public:
+  using Atomic<T>::Atomic;
+};
+
+static_assert(sizeof(PaddedAtomic<uint64>) == cache_line_size);
+static_assert(sizeof(CachePadded<uint8>) == cache_line_size);
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,179 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Try.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Varint.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Arch/Generic/Endian.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Sequential readers and writers of fixed-width integers over a
+* caller-owned byte buffer, for encoding and decoding wire messages.
+*
+* the intended use is one bounds check per message: ensure() the
+* size of the whole message up front, then put_* / get_* each field,
+* which only assert. the write_* / read_* variants check every field
+* and return a Result instead, for messages whose size isn't known
+* ahead of time. fields can sit at any alignment. varints are
+* variable length, so they are always checked.
+*/
+
+class ByteWriter {
+public:
+  /// Checks that n more bytes fit, so that many bytes of put_* calls can follow.
+  NODISCARD_ auto ensure(usize n) const -> Result<void, Error> {
+    if(remaining() < n) return Error{"ByteWriter: not enough space left!", ErrC::Overflow};
+    return Result<void, Error>::create();
+  }
+
+  template<Integer T>
+  FORCEINLINE_ auto put_little(T value) -> void {
+    KTA_ASSERT(remaining() >= sizeof(T), "ByteWriter: put past the end, missing ensure()?");
+    store_little<T>(cur_, value);
+    cur_ += sizeof(T);
+  }
+
+  template<Integer T>
+  FORCEINLINE_ auto put_big(T value) -> void {
+    KTA_ASSERT(remaining() >= sizeof(T), "ByteWriter: put past the end, missing ensure()?");
+    store_big<T>(cur_, value);
+    cur_ += sizeof(T);
+  }
+
+  FORCEINLINE_ auto put_bytes(Span<const uint8> bytes) -> void {
+    KTA_ASSERT(remaining() >= bytes.size(), "ByteWriter: put past the end, missing ensure()?");
+    if(!bytes.empty()) __builtin_memcpy(cur_, bytes.data(), bytes.size());
+    cur_ += bytes.size();
+  }
+
+  template<Integer T>
+  NODISCARD_ auto write_little(T value) -> Result<void, Error> {
+    if(remaining() < sizeof(T)) return Error{"ByteWriter: not enough space left!", ErrC::Overflow};
+    put_little(value);
+    return Result<void, Error>::create();
+  }
+
+  template<Integer T>
+  NODISCARD_ auto write_big(T value) -> Result<void, Error> {
+    if(remaining() < sizeof(T)) return Error{"ByteWriter: not enough space left!", ErrC::Overflow};
+    put_big(value);
+    return Result<void, Error>::create();
+  }
+
+  NODISCARD_ auto write_bytes(Span<const uint8> bytes) -> Result<void, Error> {
+    if(remaining() < bytes.size()) return Error{"ByteWriter: not enough space left!", ErrC::Overflow};
+    put_bytes(bytes);
+    return Result<void, Error>::create();
+  }
+
+  /// LEB128, see Varint.hpp.
+  template<VarintType T>
+  NODISCARD_ auto write_varint(T value) -> Result<void, Error> {
+    cur_ += TRY(encode_varint(value, Span<uint8>(cur_, remaining())));
+    return Result<void, Error>::create();
+  }
+
+  /// Everything written so far.
+  NODISCARD_ auto written() const -> Span<uint8> {
+    return Span<uint8>(beg_, position());
+  }
+
+  NODISCARD_ auto position()  const -> usize { return static_cast<usize>(cur_ - beg_); }
+  NODISCARD_ auto remaining() const -> usize { return static_cast<usize>(end_ - cur_); }
+
+  explicit ByteWriter(Span<uint8> buffer)
+    : beg_(buffer.data()), cur_(buffer.data()), end_(buffer.data() + buffer.size()) {}
+private:
+  uint8* beg_ = nullptr;
+  uint8* cur_ = nullptr;
+  uint8* end_ = nullptr;
+};
+
+class ByteReader {
+public:
+  /// Checks that n more bytes are there, so that many bytes of get_* calls can follow.
+  NODISCARD_ auto ensure(usize n) const -> Result<void, Error> {
+    if(remaining() < n) return Error{"ByteReader: not enough bytes left!", ErrC::Underflow};
+    return Result<void, Error>::create();
+  }
+
+  template<Integer T>
+  NODISCARD_ FORCEINLINE_ auto get_little() -> T {
+    KTA_ASSERT(remaining() >= sizeof(T), "ByteReader: get past the end, missing ensure()?");
+    const T value = load_little<T>(cur_);
+    cur_ += sizeof(T);
+    return value;
+  }
+
+  template<Integer T>
+  NODISCARD_ FORCEINLINE_ auto get_big() -> T {
+    KTA_ASSERT(remaining() >= sizeof(T), "ByteReader: get past the end, missing ensure()?");
+    const T value = load_big<T>(cur_);
+    cur_ += sizeof(T);
+    return value;
+  }
+
+  /// Returns a view into the buffer, nothing is copied.
+  NODISCARD_ FORCEINLINE_ auto get_bytes(usize n) -> Span<const uint8> {
+    KTA_ASSERT(remaining() >= n, "ByteReader: get past the end, missing ensure()?");
+    const Span<const uint8> bytes(cur_, n);
+    cur_ += n;
+    return bytes;
+  }
+
+  template<Integer T>
+  NODISCARD_ auto read_little() -> Result<T, Error> {
+    if(remaining() < sizeof(T)) return Error{"ByteReader: not enough bytes left!", ErrC::Underflow};
+    return get_little<T>();
+  }
+
+  template<Integer T>
+  NODISCARD_ auto read_big() -> Result<T, Error> {
+    if(remaining() < sizeof(T)) return Error{"ByteReader: not enough bytes left!", ErrC::Underflow};
+    return get_big<T>();
+  }
+
+  NODISCARD_ auto read_bytes(usize n) -> Result<Span<const uint8>, Error> {
+    if(remaining() < n) return Error{"ByteReader: not enough bytes left!", ErrC::Underflow};
+    return get_bytes(n);
+  }
+
+  /// LEB128, see Varint.hpp.
+  template<VarintType T>
+  NODISCARD_ auto read_varint() -> Result<T, Error> {
+    T value{};
+    cur_ += TRY(decode_varint(Span<const uint8>(cur_, remaining()), value));
+    return value;
+  }
+
+  NODISCARD_ auto skip(usize n) -> Result<void, Error> {
+    if(remaining() < n) return Error{"ByteReader: not enough bytes left!", ErrC::Underflow};
+    cur_ += n;
+    return Result<void, Error>::create();
+  }
+
+  NODISCARD_ auto position()  const -> usize { return static_cast<usize>(cur_ - beg_); }
+  NODISCARD_ auto remaining() const -> usize { return static_cast<usize>(end_ - cur_); }
+  NODISCARD_ auto at_end()    const -> bool  { return cur_ == end_; }
+
+  explicit ByteReader(Span<const uint8> buffer)
+    : beg_(buffer.data()), cur_(buffer.data()), end_(buffer.data() + buffer.size()) {}
+private:
+  const uint8* beg_ = nullptr;
+  const uint8* cur_ = nullptr;
+  const uint8* end_ = nullptr;
+};
+
+END_NAMESPACE_KTA_
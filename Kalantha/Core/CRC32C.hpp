@@ -0,0 +1,222 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Arch/Generic/Endian.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* CRC-32C (Castagnoli), as used by iSCSI, ext4, SCTP and friends.
+*
+* on x86_64 with SSE4.2 we use the crc32 instruction. it has a latency
+* of 3 cycles but a throughput of 1, so the input is split into three
+* interleaved streams whose results are merged afterwards. merging means
+* shifting a CRC past N zero bytes, which is a multiplication by x^(8N)
+* modulo the polynomial: PCLMULQDQ does it in a couple of instructions,
+* without it we fall back to a (slower, still cheap) software multiply.
+*
+* everything else goes through slicing-by-8. the implementation is picked
+* through a Dispatch on the first call and reused afterwards.
+*/
+
+BEGIN_NAMESPACE(detail_);
+
+constexpr uint32 crc32c_poly_ = 0x82F63B78; /// reflected 0x1EDC6F41
+
+struct Crc32cTables_ {
+  uint32 table[8][256]{};
+};
+
+/// table[k][b] is the CRC of byte b followed by k zero bytes.
+NODISCARD_ consteval auto make_crc32c_tables_() -> Crc32cTables_ {
+  Crc32cTables_ tables;
+  for(uint32 b = 0; b < 256; b++) {
+    uint32 crc = b;
+    for(usize i = 0; i < 8; i++) {
+      crc = (crc & 1) ? (crc >> 1) ^ crc32c_poly_ : crc >> 1;
+    }
+    tables.table[0][b] = crc;
+  }
+
+  for(usize k = 1; k < 8; k++) {
+    for(usize b = 0; b < 256; b++) {
+      const uint32 prev = tables.table[k - 1][b];
+      tables.table[k][b] = (prev >> 8) ^ tables.table[0][prev & 0xFF];
+    }
+  }
+
+  return tables;
+}
+
+inline constexpr Crc32cTables_ crc32c_tables_ = make_crc32c_tables_();
+
+/// a * b modulo the polynomial, both in reflected bit order.
+NODISCARD_ constexpr auto crc32c_multiply_(uint32 a, uint32 b) -> uint32 {
+  uint32 product = 0;
+  for(uint32 mask = 1u << 31; mask != 0; mask >>= 1) {
+    if(a & mask) product ^= b;
+    b = (b & 1) ? (b >> 1) ^ crc32c_poly_ : b >> 1;
+  }
+
+  return product;
+}
+
+/// x^exp modulo the polynomial, in reflected bit order.
+NODISCARD_ constexpr auto crc32c_xpow_(uint64 exp) -> uint32 {
+  uint32 result = 1u << 31; /// x^0
+  uint32 base   = 1u << 30; /// x^1
+  for(; exp != 0; exp >>= 1) {
+    if(exp & 1) result = crc32c_multiply_(result, base);
+    base = crc32c_multiply_(base, base);
+  }
+
+  return result;
+}
+
+/// Raw state update, the caller takes care of the pre/post inversion.
+inline auto crc32c_sw_(uint32 crc, const uint8* p, usize len) -> uint32 {
+  const auto& t = crc32c_tables_.table;
+  for(; len >= 8; p += 8, len -= 8) {
+    const uint64 word = load_little<uint64>(p) ^ crc;
+    crc = t[7][word & 0xFF]         ^ t[6][(word >> 8) & 0xFF]
+        ^ t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF]
+        ^ t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF]
+        ^ t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+  }
+
+  for(; len != 0; p++, len--) {
+    crc = t[0][(crc ^ *p) & 0xFF] ^ (crc >> 8);
+  }
+
+  return crc;
+}
+
+#  if defined(ARCH_X86_64)
+
+/*
+* Ways of shifting a CRC past some number of zero bytes.
+* with PCLMUL, the 32x32 carry-less product is reduced by the crc32
+* instruction itself, which multiplies by another x^33 along the way
+* (x^32 from the instruction, x^1 from the bit reflection), hence the
+* smaller exponent in the key.
+*/
+
+struct Crc32cShiftSoft_ {
+  template<usize bytes_>
+  static constexpr uint32 key = crc32c_xpow_(8 * bytes_);
+
+  NODISCARD_ static auto apply(uint32 crc, uint32 key) -> uint32 {
+    return crc32c_multiply_(crc, key);
+  }
+};
+
+struct Crc32cShiftClmul_ {
+  template<usize bytes_>
+  static constexpr uint32 key = crc32c_xpow_(8 * bytes_ - 33);
+
+  NODISCARD_ KTA_TARGET_SSE42_PCLMUL_ static auto apply(uint32 crc, uint32 key) -> uint32 {
+    const x86_64::Vec2i64 a{static_cast<long long>(crc), 0};
+    const x86_64::Vec2i64 b{static_cast<long long>(key), 0};
+    const x86_64::Vec2i64 product = __builtin_ia32_pclmulqdq128(a, b, 0x00);
+    return static_cast<uint32>(__builtin_ia32_crc32di(0, static_cast<uint64>(product[0])));
+  }
+};
+
+constexpr usize crc32c_long_block_  = 4096;
+constexpr usize crc32c_short_block_ = 256;
+
+template<typename Shift, usize block_>
+KTA_TARGET_SSE42_ FORCEINLINE_ auto crc32c_3way_(uint64 crc, const uint8*& p, usize& len) -> uint64 {
+  for(; len >= 3 * block_; p += 3 * block_, len -= 3 * block_) {
+    uint64 crc1 = 0, crc2 = 0;
+    for(usize i = 0; i < block_; i += 8) {
+      crc  = __builtin_ia32_crc32di(crc,  load_little<uint64>(p + i));
+      crc1 = __builtin_ia32_crc32di(crc1, load_little<uint64>(p + block_ + i));
+      crc2 = __builtin_ia32_crc32di(crc2, load_little<uint64>(p + 2 * block_ + i));
+    }
+
+    crc = Shift::apply(static_cast<uint32>(crc), Shift::template key<block_>) ^ crc1;
+    crc = Shift::apply(static_cast<uint32>(crc), Shift::template key<block_>) ^ crc2;
+  }
+
+  return crc;
+}
+
+template<typename Shift>
+KTA_TARGET_SSE42_ auto crc32c_hw_(uint32 crc, const uint8* p, usize len) -> uint32 {
+  uint64 state = crc;
+  state = crc32c_3way_<Shift, crc32c_long_block_>(state, p, len);
+  state = crc32c_3way_<Shift, crc32c_short_block_>(state, p, len);
+
+  for(; len >= 8; p += 8, len -= 8) {
+    state = __builtin_ia32_crc32di(state, load_little<uint64>(p));
+  }
+
+  auto result = static_cast<uint32>(state);
+  for(; len != 0; p++, len--) {
+    result = __builtin_ia32_crc32qi(result, *p);
+  }
+
+  return result;
+}
+
+/// PCLMULQDQ isn't part of the SSE4.2 tier, so CPUs there get checked on every call.
+KTA_TARGET_SSE42_ inline auto crc32c_sse42_(uint32 crc, const uint8* p, usize len) -> uint32 {
+  if(x86_64::cpu_features().has_pclmul()) return crc32c_hw_<Crc32cShiftClmul_>(crc, p, len);
+  return crc32c_hw_<Crc32cShiftSoft_>(crc, p, len);
+}
+
+#  endif //defined(ARCH_X86_64)
+
+using Crc32cFn_ = uint32(*)(uint32, const uint8*, usize);
+
+/// The AVX2 tier guarantees PCLMULQDQ, the SSE4.2 one doesn't.
+inline constinit Dispatch<uint32(uint32, const uint8*, usize)> crc32c_impl_{
+  &crc32c_sw_,
+#  if defined(ARCH_X86_64)
+  &crc32c_sse42_,
+  &crc32c_hw_<Crc32cShiftClmul_>,
+#  endif
+};
+
+END_NAMESPACE(detail_);
+
+/**
+ * @brief Computes the CRC-32C of a run of bytes.
+ * @param data Pointer to the first byte. May be null if len is 0.
+ * @param len The number of bytes to checksum.
+ * @param crc The CRC of any preceding data, used to checksum data in pieces.
+ * @return The updated CRC.
+ */
+NODISCARD_ inline auto crc32c(const void* data, usize len, uint32 crc = 0) -> uint32 {
+  return ~detail_::crc32c_impl_(~crc, static_cast<const uint8*>(data), len);
+}
+
+NODISCARD_ inline auto crc32c(Span<const uint8> bytes, uint32 crc = 0) -> uint32 {
+  return crc32c(bytes.data(), bytes.size(), crc);
+}
+
+/**
+ * @brief Combines the CRCs of two adjacent pieces of data.
+ * @param crc_a The CRC of the first piece.
+ * @param crc_b The CRC of the second piece, computed from crc = 0.
+ * @param len_b The length of the second piece, in bytes.
+ * @return The CRC of both pieces concatenated.
+ */
+NODISCARD_ constexpr auto crc32c_combine(uint32 crc_a, uint32 crc_b, usize len_b) -> uint32 {
+  return detail_::crc32c_multiply_(crc_a, detail_::crc32c_xpow_(8 * static_cast<uint64>(len_b))) ^ crc_b;
+}
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,40 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* The few CPU details concurrent code needs at compile time or in a
+* spin loop. nothing here asks the hardware: cpu_topology() in
+* Arch/Generic/CpuTopology.hpp reports what the running CPU says.
+*/
+
+/// Size of a destructive interference region, used to keep
+/// independently written data on separate cache lines.
+/// Apple's ARM cores use 128 byte lines, everything else we target uses 64.
+#  if defined(ARCH_ARM64) && defined(__APPLE__)
+inline constexpr usize cache_line_size = 128;
+#  else
+inline constexpr usize cache_line_size = 64;
+#  endif
+
+/// Hint to the CPU that we're spinning, to save power and
+/// avoid a memory order violation on the way out of the loop.
+FORCEINLINE_ auto cpu_relax() -> void {
+#  if defined(ARCH_X86_64) || defined(ARCH_X86)
+  __builtin_ia32_pause();
+#  elif defined(ARCH_ARM64) || defined(ARCH_ARM)
+  asm volatile("yield" ::: "memory");
+#  else
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+#  endif
+}
+
+END_NAMESPACE_KTA_
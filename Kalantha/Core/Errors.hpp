@@ -18,6 +18,7 @@ BEGIN_NAMESPACE_KTA_
   X(NoMemory, "No memory left.") \
   X(NotImplemented, "This feature has not been implimented.") \
   X(Overflow, "Something has \"overflowed\" or whatever idk.") \
+  X(Underflow, "Tried to read more than there was.") \
   X(Generic, "I couldn't think of what the error should be.")
 
 struct ErrC {
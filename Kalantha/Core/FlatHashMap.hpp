@@ -0,0 +1,153 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Hash.hpp>
+#include <Kalantha/Core/FlatHashTable.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/// The key is read-only: changing it in place would leave the
+/// entry in a slot its new hash doesn't lead to.
+template<typename K, typename V>
+class MapEntry {
+  K key_;
+public:
+  V value;
+
+  NODISCARD_ FORCEINLINE_ auto key() const -> const K& { return key_; }
+
+  template<typename KeyArg, typename ...Args>
+  MapEntry(KeyArg&& k, Args&&... args)
+    : key_(kta::forward<KeyArg>(k)), value(kta::forward<Args>(args)...) {}
+};
+
+namespace detail_ {
+  template<typename K, typename V>
+  struct MapPolicy_ {
+    using KeyType = K;
+    NODISCARD_ FORCEINLINE_ static auto key(const MapEntry<K, V>& entry) -> const K& {
+      return entry.key();
+    }
+  };
+}
+
+template<
+  typename K,
+  typename V,
+  typename Hasher = Hash<K>,
+  typename KeyEq  = EqualTo<K>,
+  typename Alloc  = BumpAllocator>
+class FlatHashMap {
+  KTA_MAKE_NONCOPYABLE(FlatHashMap);
+public:
+  using KeyType   = K;
+  using ValueType = V;
+  using EntryType = MapEntry<K, V>;
+  using TableType = FlatHashTable<EntryType, detail_::MapPolicy_<K, V>, Hasher, KeyEq, Alloc>;
+
+  using Iterator      = typename TableType::Iterator;
+  using ConstIterator = typename TableType::ConstIterator;
+
+  NODISCARD_ Iterator begin() { return table_.begin(); }
+  NODISCARD_ Iterator end()   { return table_.end();   }
+
+  NODISCARD_ ConstIterator begin() const { return table_.begin(); }
+  NODISCARD_ ConstIterator end()   const { return table_.end();   }
+
+  NODISCARD_ auto size()     const -> usize { return table_.size();     }
+  NODISCARD_ auto capacity() const -> usize { return table_.capacity(); }
+  NODISCARD_ auto empty()    const -> bool  { return table_.empty();    }
+
+  NODISCARD_ auto find(const K& key) -> V* {
+    EntryType* entry = table_.find(key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  NODISCARD_ auto find(const K& key) const -> const V* {
+    const EntryType* entry = table_.find(key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  /// Heterogeneous lookup, enabled by transparent hash/equality policies.
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  NODISCARD_ auto find(const Q& key) -> V* {
+    EntryType* entry = table_.find(key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  NODISCARD_ auto find(const Q& key) const -> const V* {
+    const EntryType* entry = table_.find(key);
+    return entry ? &entry->value : nullptr;
+  }
+
+  NODISCARD_ auto contains(const K& key) const -> bool {
+    return table_.find(key) != nullptr;
+  }
+
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  NODISCARD_ auto contains(const Q& key) const -> bool {
+    return table_.find(key) != nullptr;
+  }
+
+  /// Constructs V from args if key isn't present yet. If it is,
+  /// the existing entry is returned and nothing is constructed.
+  template<typename ...Args>
+  auto emplace(const K& key, Args&&... args) -> Result<InsertResult<EntryType>, Error> {
+    return table_.emplace(key, key, kta::forward<Args>(args)...);
+  }
+
+  template<typename ...Args>
+  auto emplace(K&& key, Args&&... args) -> Result<InsertResult<EntryType>, Error> {
+    return table_.emplace(key, kta::move(key), kta::forward<Args>(args)...);
+  }
+
+  /// Inserts or overwrites.
+  template<typename Arg>
+  auto insert_or_assign(const K& key, Arg&& value) -> Result<InsertResult<EntryType>, Error> {
+    auto res = table_.emplace(key, key, kta::forward<Arg>(value));
+    if(res.has_value() && !res.value().inserted) {
+      res.value().slot->value = kta::forward<Arg>(value);
+    }
+
+    return res;
+  }
+
+  auto erase(const K& key) -> bool {
+    return table_.erase(key);
+  }
+
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  auto erase(const Q& key) -> bool {
+    return table_.erase(key);
+  }
+
+  auto reserve(usize count) -> Result<void, Error> { return table_.reserve(count); }
+  auto clear() -> void { table_.clear(); }
+
+  FlatHashMap(FlatHashMap&& other) : table_(kta::move(other.table_)) {}
+
+  auto operator=(FlatHashMap&& other) -> FlatHashMap& {
+    table_ = kta::move(other.table_);
+    return *this;
+  }
+
+  explicit FlatHashMap(Alloc* alloc) : table_(alloc) {}
+  FlatHashMap()  = default;
+  ~FlatHashMap() = default;
+private:
+  TableType table_;
+};
+
+END_NAMESPACE_KTA_
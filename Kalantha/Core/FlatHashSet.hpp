@@ -0,0 +1,109 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Hash.hpp>
+#include <Kalantha/Core/FlatHashTable.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+BEGIN_NAMESPACE_KTA_
+
+namespace detail_ {
+  template<typename K>
+  struct SetPolicy_ {
+    using KeyType = K;
+    NODISCARD_ FORCEINLINE_ static auto key(const K& key) -> const K& {
+      return key;
+    }
+  };
+}
+
+template<
+  typename K,
+  typename Hasher = Hash<K>,
+  typename KeyEq  = EqualTo<K>,
+  typename Alloc  = BumpAllocator>
+class FlatHashSet {
+  KTA_MAKE_NONCOPYABLE(FlatHashSet);
+public:
+  using KeyType   = K;
+  using TableType = FlatHashTable<K, detail_::SetPolicy_<K>, Hasher, KeyEq, Alloc>;
+
+  /// Keys must not be modified in place, that would break the table.
+  using Iterator      = typename TableType::ConstIterator;
+  using ConstIterator = typename TableType::ConstIterator;
+
+  NODISCARD_ ConstIterator begin() const { return table_.begin(); }
+  NODISCARD_ ConstIterator end()   const { return table_.end();   }
+
+  NODISCARD_ auto size()     const -> usize { return table_.size();     }
+  NODISCARD_ auto capacity() const -> usize { return table_.capacity(); }
+  NODISCARD_ auto empty()    const -> bool  { return table_.empty();    }
+
+  NODISCARD_ auto find(const K& key) const -> const K* {
+    return table_.find(key);
+  }
+
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  NODISCARD_ auto find(const Q& key) const -> const K* {
+    return table_.find(key);
+  }
+
+  NODISCARD_ auto contains(const K& key) const -> bool {
+    return table_.find(key) != nullptr;
+  }
+
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  NODISCARD_ auto contains(const Q& key) const -> bool {
+    return table_.find(key) != nullptr;
+  }
+
+  /// Returns true if the key was inserted, false if it was already present.
+  auto insert(const K& key) -> Result<bool, Error> {
+    auto res = table_.emplace(key, key);
+    if(!res.has_value()) return res.release_error();
+    return res.value().inserted;
+  }
+
+  auto insert(K&& key) -> Result<bool, Error> {
+    auto res = table_.emplace(key, kta::move(key));
+    if(!res.has_value()) return res.release_error();
+    return res.value().inserted;
+  }
+
+  auto erase(const K& key) -> bool {
+    return table_.erase(key);
+  }
+
+  template<typename Q> requires TransparentHashing<Hasher, KeyEq>
+  auto erase(const Q& key) -> bool {
+    return table_.erase(key);
+  }
+
+  auto reserve(usize count) -> Result<void, Error> { return table_.reserve(count); }
+  auto clear() -> void { table_.clear(); }
+
+  FlatHashSet(FlatHashSet&& other) : table_(kta::move(other.table_)) {}
+
+  auto operator=(FlatHashSet&& other) -> FlatHashSet& {
+    table_ = kta::move(other.table_);
+    return *this;
+  }
+
+  explicit FlatHashSet(Alloc* alloc) : table_(alloc) {}
+  FlatHashSet()  = default;
+  ~FlatHashSet() = default;
+private:
+  TableType table_;
+};
+
+END_NAMESPACE_KTA_
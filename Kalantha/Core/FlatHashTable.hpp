@@ -0,0 +1,392 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Limits.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Hash.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Allocators/AllocatorBase.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Open addressing hash table shared by FlatHashMap and FlatHashSet.
+*
+* every slot has a control byte. full slots store the low 7 bits of the
+* hash (H2), empty and deleted slots have their high bit set. control
+* bytes are probed 16 at a time (one SSE2 compare + pmovmskb), so most
+* lookups touch a single group and compare a single key.
+*
+* groups are aligned and probed with triangular steps, which visits every
+* group for a power-of-two group count. a lookup stops at the first group
+* containing an empty slot - which means an erased slot can go straight
+* back to empty whenever its own group already has one, and only needs a
+* tombstone otherwise.
+*/
+
+BEGIN_NAMESPACE(detail_);
+
+constexpr int8 ctrl_empty_   = -128; /// 0b10000000
+constexpr int8 ctrl_deleted_ = -2;   /// 0b11111110
+
+class GroupMask_ {
+public:
+  NODISCARD_ FORCEINLINE_ auto any()    const -> bool  { return bits_ != 0; }
+  NODISCARD_ FORCEINLINE_ auto lowest() const -> usize { return __builtin_ctz(bits_); }
+  FORCEINLINE_ auto clear_lowest() -> void { bits_ &= bits_ - 1; }
+  FORCEINLINE_ explicit GroupMask_(uint32 bits) : bits_(bits) {}
+private:
+  uint32 bits_ = 0;
+};
+
+class CtrlGroup_ {
+public:
+  constexpr static usize width = 16;
+
+#  if defined(ARCH_X86_64)
+  NODISCARD_ FORCEINLINE_ auto match(int8 h2) const -> GroupMask_ {
+    const auto eq = x86_64::cmpeq_128(vec_, x86_64::splat_128(static_cast<char>(h2)));
+    return GroupMask_(x86_64::movemask_128(eq));
+  }
+
+  NODISCARD_ FORCEINLINE_ auto match_empty() const -> GroupMask_ {
+    return match(ctrl_empty_);
+  }
+
+  /// Empty and deleted slots are exactly the ones with the sign bit set.
+  NODISCARD_ FORCEINLINE_ auto match_free() const -> GroupMask_ {
+    return GroupMask_(x86_64::movemask_128(vec_));
+  }
+
+  FORCEINLINE_ explicit CtrlGroup_(const int8* ctrl) : vec_(x86_64::load_128(ctrl)) {}
+private:
+  x86_64::Vec16i8 vec_;
+#  else
+  NODISCARD_ FORCEINLINE_ auto match(int8 h2) const -> GroupMask_ {
+    uint32 bits = 0;
+    for(usize i = 0; i < width; i++) bits |= static_cast<uint32>(ctrl_[i] == h2) << i;
+    return GroupMask_(bits);
+  }
+
+  NODISCARD_ FORCEINLINE_ auto match_empty() const -> GroupMask_ {
+    return match(ctrl_empty_);
+  }
+
+  NODISCARD_ FORCEINLINE_ auto match_free() const -> GroupMask_ {
+    uint32 bits = 0;
+    for(usize i = 0; i < width; i++) bits |= static_cast<uint32>(ctrl_[i] < 0) << i;
+    return GroupMask_(bits);
+  }
+
+  FORCEINLINE_ explicit CtrlGroup_(const int8* ctrl) : ctrl_(ctrl) {}
+private:
+  const int8* ctrl_;
+#  endif
+};
+
+END_NAMESPACE(detail_);
+
+template<typename T>
+struct InsertResult {
+  T* slot = nullptr;
+  bool inserted = false;
+};
+
+template<typename Slot, typename Policy, typename Hasher, typename KeyEq, typename Alloc>
+class FlatHashTable {
+  KTA_MAKE_NONCOPYABLE(FlatHashTable);
+public:
+  static_assert(IsBaseOf<AllocatorBase, Alloc>, "Alloc must derive from AllocatorBase!");
+
+  using SlotType = Slot;
+  using KeyType  = typename Policy::KeyType;
+  using Group_   = detail_::CtrlGroup_;
+
+  constexpr static usize group_width = Group_::width;
+
+  template<typename T>
+  class Iterator_ {
+  public:
+    NODISCARD_ auto operator*()  const -> T& { return *slot_; }
+    NODISCARD_ auto operator->() const -> T* { return slot_;  }
+
+    auto operator++() -> Iterator_& {
+      ++ctrl_;
+      ++slot_;
+      skip_free_();
+      return *this;
+    }
+
+    NODISCARD_ auto operator==(const Iterator_& other) const -> bool { return ctrl_ == other.ctrl_; }
+    NODISCARD_ auto operator!=(const Iterator_& other) const -> bool { return ctrl_ != other.ctrl_; }
+
+    Iterator_(const int8* ctrl, const int8* end, T* slot) : ctrl_(ctrl), end_(end), slot_(slot) {
+      skip_free_();
+    }
+  private:
+    auto skip_free_() -> void {
+      while(ctrl_ < end_ && *ctrl_ < 0) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+    const int8* ctrl_ = nullptr;
+    const int8* end_  = nullptr;
+    T* slot_ = nullptr;
+  };
+
+  using Iterator      = Iterator_<Slot>;
+  using ConstIterator = Iterator_<const Slot>;
+
+  NODISCARD_ Iterator begin() { return Iterator(ctrl_, ctrl_ + cap_, slots_); }
+  NODISCARD_ Iterator end()   { return Iterator(ctrl_ + cap_, ctrl_ + cap_, slots_ + cap_); }
+
+  NODISCARD_ ConstIterator begin() const { return ConstIterator(ctrl_, ctrl_ + cap_, slots_); }
+  NODISCARD_ ConstIterator end()   const { return ConstIterator(ctrl_ + cap_, ctrl_ + cap_, slots_ + cap_); }
+
+  NODISCARD_ auto size()     const -> usize  { return size_;      }
+  NODISCARD_ auto capacity() const -> usize  { return cap_;       }
+  NODISCARD_ auto empty()    const -> bool   { return size_ == 0; }
+  NODISCARD_ auto allocator() const -> Alloc* { return alloc_;    }
+
+  template<typename Q>
+  NODISCARD_ FORCEINLINE_ auto find(const Q& key) -> Slot* {
+    if(size_ == 0) return nullptr;
+    return find_(key, hasher_(key));
+  }
+
+  template<typename Q>
+  NODISCARD_ FORCEINLINE_ auto find(const Q& key) const -> const Slot* {
+    if(size_ == 0) return nullptr;
+    return find_(key, hasher_(key));
+  }
+
+  /// Inserts a slot constructed from args, unless one with an
+  /// equivalent key is already present. key is only used for lookup.
+  template<typename Q, typename ...Args>
+  auto emplace(const Q& key, Args&&... args) -> Result<InsertResult<Slot>, Error> {
+    const uint64 hash = hasher_(key);
+    if(size_ != 0) {
+      if(Slot* existing = find_(key, hash)) return InsertResult<Slot>{existing, false};
+    }
+
+    usize index = cap_ != 0 ? find_free_(ctrl_, group_mask_(), hash) : 0;
+    if(cap_ == 0 || (growth_left_ == 0 && ctrl_[index] == detail_::ctrl_empty_)) {
+      auto res = rehash_(size_ * 2 <= max_load_(cap_) ? cap_ : cap_ * 2);
+      if(!res.has_value()) return res.release_error();
+      index = find_free_(ctrl_, group_mask_(), hash);
+    }
+
+    if(ctrl_[index] == detail_::ctrl_empty_) --growth_left_;
+    ctrl_[index] = h2_(hash);
+
+    Slot* slot = kta::construct_at<Slot>(slots_ + index, kta::forward<Args>(args)...);
+    ++size_;
+    return InsertResult<Slot>{slot, true};
+  }
+
+  template<typename Q>
+  auto erase(const Q& key) -> bool {
+    if(size_ == 0) return false;
+    Slot* slot = find_(key, hasher_(key));
+    if(slot == nullptr) return false;
+
+    const auto index = static_cast<usize>(slot - slots_);
+    kta::destroy_at<Slot>(slot);
+
+    /// See the comment at the top of this file.
+    const usize group = index & ~(group_width - 1);
+    if(Group_(ctrl_ + group).match_empty().any()) {
+      ctrl_[index] = detail_::ctrl_empty_;
+      ++growth_left_;
+    } else {
+      ctrl_[index] = detail_::ctrl_deleted_;
+    }
+
+    --size_;
+    return true;
+  }
+
+  auto reserve(usize count) -> Result<void, Error> {
+    usize new_cap = cap_ ? cap_ : group_width;
+    while(max_load_(new_cap) < count) {
+      if(new_cap > NumericLimits<usize>::max() / 2)
+        return Error{"FlatHashTable: capacity overflow!", ErrC::Overflow};
+      new_cap *= 2;
+    }
+
+    if(new_cap == cap_) return Result<void, Error>::create();
+    return rehash_(new_cap);
+  }
+
+  auto clear() -> void {
+    destroy_slots_();
+    for(usize i = 0; i < cap_; i++) ctrl_[i] = detail_::ctrl_empty_;
+    growth_left_ = max_load_(cap_);
+    size_ = 0;
+  }
+
+  FlatHashTable(FlatHashTable&& other) { take_(other); }
+
+  auto operator=(FlatHashTable&& other) -> FlatHashTable& {
+    if(this != &other) {
+      destroy_slots_();
+      release_();
+      take_(other);
+    }
+
+    return *this;
+  }
+
+  explicit FlatHashTable(Alloc* alloc) : alloc_(alloc) {}
+  FlatHashTable() = default;
+
+  ~FlatHashTable() {
+    destroy_slots_();
+    release_();
+  }
+private:
+  /// Upper 57 bits pick the group, lower 7 bits are stored in the control byte.
+  NODISCARD_ FORCEINLINE_ static auto h1_(uint64 hash) -> usize { return static_cast<usize>(hash >> 7); }
+  NODISCARD_ FORCEINLINE_ static auto h2_(uint64 hash) -> int8  { return static_cast<int8>(hash & 0x7F); }
+
+  NODISCARD_ FORCEINLINE_ auto group_mask_() const -> usize { return (cap_ / group_width) - 1; }
+  NODISCARD_ FORCEINLINE_ static auto max_load_(usize cap) -> usize { return cap - cap / 8; }
+
+  template<typename Q>
+  NODISCARD_ FORCEINLINE_ auto find_(const Q& key, uint64 hash) const -> Slot* {
+    const int8 h2 = h2_(hash);
+    const usize mask = group_mask_();
+    usize group = h1_(hash) & mask;
+
+    for(usize step = 1;; step++) {
+      const usize base = group * group_width;
+      const Group_ ctrl(ctrl_ + base);
+
+      for(auto match = ctrl.match(h2); match.any(); match.clear_lowest()) {
+        Slot* slot = slots_ + base + match.lowest();
+        if(key_eq_(Policy::key(*slot), key)) [[likely]] return slot;
+      }
+
+      if(ctrl.match_empty().any()) [[likely]] return nullptr;
+      group = (group + step) & mask;
+    }
+  }
+
+  NODISCARD_ static auto find_free_(const int8* ctrl, usize mask, uint64 hash) -> usize {
+    usize group = h1_(hash) & mask;
+    for(usize step = 1;; step++) {
+      const usize base = group * group_width;
+      const auto free = Group_(ctrl + base).match_free();
+      if(free.any()) return base + free.lowest();
+      group = (group + step) & mask;
+    }
+  }
+
+  NODISCARD_ static auto slots_offset_(usize cap) -> usize {
+    return (cap + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+  }
+
+  NODISCARD_ static auto block_size_(usize cap) -> usize {
+    return slots_offset_(cap) + cap * sizeof(Slot);
+  }
+
+  NODISCARD_ static auto block_align_() -> usize {
+    return alignof(Slot) > group_width ? alignof(Slot) : group_width;
+  }
+
+  auto rehash_(usize new_cap) -> Result<void, Error> {
+    if(new_cap < group_width) new_cap = group_width;
+    if(alloc_ == nullptr || new_cap > NumericLimits<usize>::max() / (sizeof(Slot) + 1))
+      return Error{"FlatHashTable: allocation failure!", ErrC::NoMemory};
+
+    auto* block = static_cast<uint8*>(alloc_->allocate_bytes(block_align_(), block_size_(new_cap)));
+    if(block == nullptr) return Error{"FlatHashTable: allocation failure!", ErrC::NoMemory};
+
+    auto* new_ctrl  = reinterpret_cast<int8*>(block);
+    auto* new_slots = reinterpret_cast<Slot*>(block + slots_offset_(new_cap));
+    const usize new_mask = (new_cap / group_width) - 1;
+    for(usize i = 0; i < new_cap; i++) new_ctrl[i] = detail_::ctrl_empty_;
+
+    for(usize i = 0; i < cap_; i++) {
+      if(ctrl_[i] < 0) continue;
+      Slot* old = slots_ + i;
+      const uint64 hash  = hasher_(Policy::key(*old));
+      const usize  index = find_free_(new_ctrl, new_mask, hash);
+      new_ctrl[index] = h2_(hash);
+
+      if constexpr(IsTriviallyCopyable<Slot>) {
+        __builtin_memcpy(new_slots + index, old, sizeof(Slot));
+      } else {
+        kta::construct_at<Slot>(new_slots + index, kta::move(*old));
+        kta::destroy_at<Slot>(old);
+      }
+    }
+
+    release_();
+    ctrl_  = new_ctrl;
+    slots_ = new_slots;
+    cap_   = new_cap;
+    growth_left_ = max_load_(new_cap) - size_;
+    return Result<void, Error>::create();
+  }
+
+  auto destroy_slots_() -> void {
+    if constexpr(!IsTriviallyDestructible<Slot>) {
+      for(usize i = 0; i < cap_; i++) {
+        if(ctrl_[i] >= 0) kta::destroy_at<Slot>(slots_ + i);
+      }
+    }
+  }
+
+  auto release_() -> void {
+    if(cap_ == 0) return;
+    UNUSED_ auto res = alloc_->deallocate_bytes(ctrl_, block_size_(cap_));
+    ctrl_  = nullptr;
+    slots_ = nullptr;
+    cap_   = 0;
+    growth_left_ = 0;
+  }
+
+  auto take_(FlatHashTable& other) -> void {
+    ctrl_  = other.ctrl_;
+    slots_ = other.slots_;
+    cap_   = other.cap_;
+    size_  = other.size_;
+    alloc_ = other.alloc_;
+    growth_left_ = other.growth_left_;
+
+    other.ctrl_  = nullptr;
+    other.slots_ = nullptr;
+    other.cap_   = 0;
+    other.size_  = 0;
+    other.growth_left_ = 0;
+  }
+
+  int8* ctrl_  = nullptr;
+  Slot* slots_ = nullptr;
+  usize cap_   = 0;
+  usize size_  = 0;
+  usize growth_left_ = 0;
+  Alloc* alloc_ = nullptr;
+  Hasher hasher_{};
+  KeyEq key_eq_{};
+};
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,466 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/StringView.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Arch/Generic/Endian.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Fast, non-cryptographic 64-bit hashing.
+*
+* inputs of up to 256 bytes go through a wyhash-style construction: a few
+* 64x64->128 multiplies folded together, which is about as cheap as it gets
+* for hash table keys. longer inputs switch to an XXH3-style accumulator:
+* eight 64-bit lanes, 32x32->64 multiplies per 64-byte stripe, and a
+* scramble every 16 stripes. that loop maps directly onto AVX2 (four lanes
+* per register), which we use when the CPU supports it. both paths produce
+* identical results.
+*
+* the output is stable across platforms (all reads are little-endian),
+* but is NOT guaranteed to be stable across versions of this library.
+* don't persist it.
+*/
+
+BEGIN_NAMESPACE(detail_);
+
+constexpr uint64 hash_secret_[4] = {
+  0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL,
+  0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL,
+};
+
+constexpr usize hash_stripe_len_    = 64;
+constexpr usize hash_block_stripes_ = 16;
+constexpr usize hash_long_min_      = 256;
+constexpr usize hash_secret_words_  = 24;
+constexpr uint64 hash_prime32_      = 0x9E3779B1ULL;
+
+constexpr uint64 hash_acc_init_[8] = {
+  0x00000000C2B2AE3DULL, 0x9E3779B185EBCA87ULL,
+  0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+  0x85EBCA77C2B2AE63ULL, 0x0000000085EBCA77ULL,
+  0x27D4EB2F165667C5ULL, 0x000000009E3779B1ULL,
+};
+
+/// Full 64x64->128 multiply. a receives the low half, b the high half.
+FORCEINLINE_ constexpr auto mum_(uint64& a, uint64& b) -> void {
+#  if defined(__SIZEOF_INT128__)
+  const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+  a = static_cast<uint64>(r);
+  b = static_cast<uint64>(r >> 64);
+#  else
+  const uint64 ha = a >> 32, hb = b >> 32;
+  const uint64 la = static_cast<uint32>(a), lb = static_cast<uint32>(b);
+  const uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  const uint64 t  = rl + (rm0 << 32);
+  uint64 carry    = t < rl;
+  const uint64 lo = t + (rm1 << 32);
+  carry += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#  endif
+}
+
+NODISCARD_ FORCEINLINE_ constexpr auto mix_(uint64 a, uint64 b) -> uint64 {
+  mum_(a, b);
+  return a ^ b;
+}
+
+NODISCARD_ FORCEINLINE_ auto read64_(const uint8* p) -> uint64 { return load_little<uint64>(p); }
+NODISCARD_ FORCEINLINE_ auto read32_(const uint8* p) -> uint64 { return load_little<uint32>(p); }
+
+struct HashSecret_ {
+  uint64 words[hash_secret_words_]{};
+};
+
+/// The long-input secret is a splitmix64 sequence.
+/// Any high-entropy constant would do, this one is simply reproducible.
+NODISCARD_ consteval auto make_hash_secret_() -> HashSecret_ {
+  HashSecret_ secret;
+  uint64 state = 0x6B616C616E746861ULL; /// "kalantha"
+  for(usize i = 0; i < hash_secret_words_; i++) {
+    uint64 z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    secret.words[ i ] = z ^ (z >> 31);
+  }
+  return secret;
+}
+
+inline constexpr HashSecret_ hash_long_secret_ = make_hash_secret_();
+
+/// Seeded secrets are derived the same way XXH3 does it.
+NODISCARD_ inline auto seeded_secret_(uint64 seed) -> HashSecret_ {
+  HashSecret_ secret = hash_long_secret_;
+  for(usize i = 0; i < hash_secret_words_; i++) {
+    secret.words[ i ] += (i & 1) ? (0 - seed) : seed;
+  }
+  return secret;
+}
+
+NODISCARD_ inline auto hash_short_(const uint8* p, usize len, uint64 seed) -> uint64 {
+  const uint64* s = hash_secret_;
+  seed ^= mix_(seed ^ s[0], s[1]);
+  uint64 a = 0, b = 0;
+
+  if(len <= 16) [[likely]] {
+    if(len >= 4) {
+      const usize off = (len >> 3) << 2;
+      a = (read32_(p) << 32) | read32_(p + off);
+      b = (read32_(p + len - 4) << 32) | read32_(p + len - 4 - off);
+    } else if(len > 0) {
+      a = (static_cast<uint64>(p[0]) << 16)
+        | (static_cast<uint64>(p[len >> 1]) << 8)
+        |  static_cast<uint64>(p[len - 1]);
+    }
+  } else {
+    usize i = len;
+    if(i > 48) {
+      uint64 see1 = seed, see2 = seed;
+      do {
+        seed = mix_(read64_(p)      ^ s[1], read64_(p + 8)  ^ seed);
+        see1 = mix_(read64_(p + 16) ^ s[2], read64_(p + 24) ^ see1);
+        see2 = mix_(read64_(p + 32) ^ s[3], read64_(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while(i > 48);
+      seed ^= see1 ^ see2;
+    }
+
+    while(i > 16) {
+      seed = mix_(read64_(p) ^ s[1], read64_(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+
+    /// May reach back into bytes that were already consumed, that's fine.
+    a = read64_(p + i - 16);
+    b = read64_(p + i - 8);
+  }
+
+  a ^= s[1];
+  b ^= seed;
+  mum_(a, b);
+  return mix_(a ^ s[0] ^ len, b ^ s[1]);
+}
+
+FORCEINLINE_ auto accumulate_stripe_(uint64* acc, const uint8* p, const uint64* key) -> void {
+  for(usize i = 0; i < 8; i++) {
+    const uint64 data = read64_(p + i * 8);
+    const uint64 mixed = data ^ key[ i ];
+    acc[i ^ 1] += data;
+    acc[i] += (mixed & 0xFFFFFFFFULL) * (mixed >> 32);
+  }
+}
+
+FORCEINLINE_ auto scramble_(uint64* acc, const uint64* secret) -> void {
+  for(usize i = 0; i < 8; i++) {
+    acc[i] ^= acc[i] >> 47;
+    acc[i] ^= secret[hash_block_stripes_ + i];
+    acc[i] *= hash_prime32_;
+  }
+}
+
+/// index is the position of the first stripe in the overall input,
+/// which decides both its key offset and when to scramble.
+inline auto accumulate_scalar_(uint64* acc, const uint8* p, usize count, usize index, const uint64* secret) -> void {
+  for(usize n = 0; n < count; n++, index++) {
+    const usize in_block = index % hash_block_stripes_;
+    accumulate_stripe_(acc, p + n * hash_stripe_len_, secret + in_block);
+    if(in_block == hash_block_stripes_ - 1) scramble_(acc, secret);
+  }
+}
+
+#  if defined(ARCH_X86_64)
+KTA_TARGET_AVX2_ inline auto accumulate_avx2_(uint64* acc, const uint8* p, usize count, usize index, const uint64* secret) -> void {
+  using x86_64::Vec4u64;
+  Vec4u64 lo = x86_64::load_256(acc);
+  Vec4u64 hi = x86_64::load_256(acc + 4);
+
+  for(usize n = 0; n < count; n++, index++) {
+    const usize in_block = index % hash_block_stripes_;
+    const uint8* stripe  = p + n * hash_stripe_len_;
+    const uint64* key    = secret + in_block;
+
+    const Vec4u64 data_lo  = x86_64::load_256(stripe);
+    const Vec4u64 data_hi  = x86_64::load_256(stripe + 32);
+    const Vec4u64 mixed_lo = data_lo ^ x86_64::load_256(key);
+    const Vec4u64 mixed_hi = data_hi ^ x86_64::load_256(key + 4);
+
+    /// acc[i] += data[i ^ 1] + lo32(mixed[i]) * hi32(mixed[i])  (vpshufd + vpmuludq)
+    lo += __builtin_shufflevector(data_lo, data_lo, 1, 0, 3, 2)
+       + (mixed_lo & 0xFFFFFFFFULL) * (mixed_lo >> 32);
+    hi += __builtin_shufflevector(data_hi, data_hi, 1, 0, 3, 2)
+       + (mixed_hi & 0xFFFFFFFFULL) * (mixed_hi >> 32);
+
+    if(in_block == hash_block_stripes_ - 1) {
+      lo = ((lo ^ (lo >> 47)) ^ x86_64::load_256(secret + hash_block_stripes_)) * hash_prime32_;
+      hi = ((hi ^ (hi >> 47)) ^ x86_64::load_256(secret + hash_block_stripes_ + 4)) * hash_prime32_;
+    }
+  }
+
+  x86_64::store_256(acc, lo);
+  x86_64::store_256(acc + 4, hi);
+}
+#  endif
+
+inline constinit Dispatch<void(uint64*, const uint8*, usize, usize, const uint64*)> accumulate_{
+  &accumulate_scalar_,
+#  if defined(ARCH_X86_64)
+  nullptr,
+  &accumulate_avx2_,
+#  endif
+};
+
+NODISCARD_ inline auto merge_long_(const uint64* acc, const uint64* secret, usize len) -> uint64 {
+  uint64 result = static_cast<uint64>(len) * 0x9E3779B185EBCA87ULL;
+  for(usize i = 0; i < 4; i++) {
+    result += mix_(acc[2 * i] ^ secret[2 * i + 3], acc[2 * i + 1] ^ secret[2 * i + 4]);
+  }
+
+  result ^= result >> 37;
+  result *= 0x165667919E3779F9ULL;
+  return result ^ (result >> 32);
+}
+
+/// The final stripe always covers the last 64 bytes of the input,
+/// overlapping whatever the regular stripes already consumed.
+constexpr usize hash_last_stripe_key_ = 7;
+
+NODISCARD_ inline auto hash_long_(const uint8* p, usize len, uint64 seed) -> uint64 {
+  HashSecret_ seeded;
+  const uint64* secret = hash_long_secret_.words;
+  if(seed != 0) {
+    seeded = seeded_secret_(seed);
+    secret = seeded.words;
+  }
+
+  uint64 acc[8];
+  __builtin_memcpy(acc, hash_acc_init_, sizeof(acc));
+
+  accumulate_(acc, p, (len - 1) / hash_stripe_len_, 0, secret);
+  accumulate_stripe_(acc, p + len - hash_stripe_len_, secret + hash_last_stripe_key_);
+  return merge_long_(acc, secret, len);
+}
+
+END_NAMESPACE(detail_);
+
+/**
+ * @brief Hash a run of bytes.
+ * @param data Pointer to the first byte. May be null if len is 0.
+ * @param len The number of bytes to hash.
+ * @param seed Optional seed, different seeds give unrelated hash functions.
+ * @return The 64-bit hash.
+ */
+NODISCARD_ inline auto hash_bytes(const void* data, usize len, uint64 seed = 0) -> uint64 {
+  const auto* p = static_cast<const uint8*>(data);
+  if(len <= detail_::hash_long_min_) [[likely]]
+    return detail_::hash_short_(p, len, seed);
+  return detail_::hash_long_(p, len, seed);
+}
+
+NODISCARD_ inline auto hash(Span<const uint8> bytes, uint64 seed = 0) -> uint64 {
+  return hash_bytes(bytes.data(), bytes.size(), seed);
+}
+
+template<Character Char>
+NODISCARD_ auto hash(const StringView_<Char>& sv, uint64 seed = 0) -> uint64 {
+  return hash_bytes(sv.data(), sv.size_bytes(), seed);
+}
+
+/// Integers take a shortcut: two multiplies, no memory access.
+template<Integer T>
+NODISCARD_ constexpr auto hash(T value, uint64 seed = 0) -> uint64 {
+  const uint64* s = detail_::hash_secret_;
+  uint64 a = static_cast<uint64>(value) ^ s[0];
+  uint64 b = seed ^ s[1];
+  detail_::mum_(a, b);
+  return detail_::mix_(a ^ s[0], b ^ s[1]);
+}
+
+/*
+* Incremental version of hash_bytes(). Feeding the same bytes in any
+* number of pieces gives the same result as hashing them in one go.
+*
+* up to 256 bytes are buffered. past that, whole stripes are consumed
+* as they arrive, always keeping at least one byte back so finish()
+* has something to build the final stripe from.
+*/
+
+class StreamingHasher {
+public:
+  auto update(const void* data, usize len) -> StreamingHasher& {
+    const auto* p = static_cast<const uint8*>(data);
+    total_ += len;
+
+    if(buffered_ + len <= buffer_size_) {
+      if(len != 0) __builtin_memcpy(buffer_ + buffered_, p, len);
+      buffered_ += len;
+      return *this;
+    }
+
+    if(buffered_ > 0) {
+      const usize fill = buffer_size_ - buffered_;
+      __builtin_memcpy(buffer_ + buffered_, p, fill);
+      consume_(buffer_, buffer_stripes_);
+      buffered_ = 0;
+      p   += fill;
+      len -= fill;
+    }
+
+    while(len > buffer_size_) {
+      consume_(p, buffer_stripes_);
+      p   += buffer_size_;
+      len -= buffer_size_;
+    }
+
+    __builtin_memcpy(buffer_, p, len);
+    buffered_ = len;
+    return *this;
+  }
+
+  auto update(Span<const uint8> bytes) -> StreamingHasher& {
+    return update(bytes.data(), bytes.size());
+  }
+
+  template<Character Char>
+  auto update(const StringView_<Char>& sv) -> StreamingHasher& {
+    return update(sv.data(), sv.size_bytes());
+  }
+
+  NODISCARD_ auto finish() const -> uint64 {
+    if(total_ <= detail_::hash_long_min_)
+      return detail_::hash_short_(buffer_, total_, seed_);
+
+    uint64 acc[8];
+    __builtin_memcpy(acc, acc_, sizeof(acc));
+    detail_::accumulate_(acc, buffer_, (buffered_ - 1) / stripe_len_, stripes_, secret_.words);
+
+    uint8 last[stripe_len_];
+    if(buffered_ >= stripe_len_) {
+      __builtin_memcpy(last, buffer_ + buffered_ - stripe_len_, stripe_len_);
+    } else {
+      const usize from_prev = stripe_len_ - buffered_;
+      __builtin_memcpy(last, last_stripe_ + buffered_, from_prev);
+      __builtin_memcpy(last + from_prev, buffer_, buffered_);
+    }
+
+    detail_::accumulate_stripe_(acc, last, secret_.words + detail_::hash_last_stripe_key_);
+    return detail_::merge_long_(acc, secret_.words, total_);
+  }
+
+  auto reset(uint64 seed = 0) -> void {
+    __builtin_memcpy(acc_, detail_::hash_acc_init_, sizeof(acc_));
+    secret_   = seed ? detail_::seeded_secret_(seed) : detail_::hash_long_secret_;
+    seed_     = seed;
+    buffered_ = 0;
+    total_    = 0;
+    stripes_  = 0;
+  }
+
+  explicit StreamingHasher(uint64 seed = 0) { reset(seed); }
+private:
+  constexpr static usize stripe_len_     = detail_::hash_stripe_len_;
+  constexpr static usize buffer_size_    = detail_::hash_long_min_;
+  constexpr static usize buffer_stripes_ = buffer_size_ / stripe_len_;
+
+  auto consume_(const uint8* p, usize count) -> void {
+    detail_::accumulate_(acc_, p, count, stripes_, secret_.words);
+    __builtin_memcpy(last_stripe_, p + (count - 1) * stripe_len_, stripe_len_);
+    stripes_ += count;
+  }
+
+  uint64 acc_[8]{};
+  detail_::HashSecret_ secret_;
+  uint8 buffer_[buffer_size_]{};
+  uint8 last_stripe_[stripe_len_]{};
+  usize buffered_ = 0;
+  usize total_    = 0;
+  usize stripes_  = 0;
+  uint64 seed_    = 0;
+};
+
+/*
+* Hashing and equality policies for the hash containers.
+* Hash<T> is specialized for the types Kalantha knows about,
+* user types can provide their own specialization.
+*/
+
+template<typename T>
+struct Hash;
+
+template<Integer T>
+struct Hash<T> {
+  NODISCARD_ constexpr auto operator()(T value) const -> uint64 {
+    return kta::hash(value);
+  }
+};
+
+template<typename T>
+struct Hash<T*> {
+  NODISCARD_ auto operator()(T* ptr) const -> uint64 {
+    return kta::hash(reinterpret_cast<uintptr>(ptr));
+  }
+};
+
+template<Character Char>
+struct Hash<StringView_<Char>> {
+  NODISCARD_ auto operator()(const StringView_<Char>& sv) const -> uint64 {
+    return kta::hash(sv);
+  }
+};
+
+template<>
+struct Hash<Span<const uint8>> {
+  NODISCARD_ auto operator()(Span<const uint8> bytes) const -> uint64 {
+    return kta::hash(bytes);
+  }
+};
+
+template<typename T>
+struct EqualTo {
+  NODISCARD_ constexpr auto operator()(const T& a, const T& b) const -> bool {
+    return a == b;
+  }
+};
+
+/// Transparent policies: anything convertible to a StringView can be
+/// used to look up a key, without having to construct the key type.
+struct StringHash {
+  using IsTransparent = void;
+
+  template<ConvertibleTo<StringView> S>
+  NODISCARD_ auto operator()(const S& str) const -> uint64 {
+    return kta::hash(StringView(str));
+  }
+};
+
+struct StringEqual {
+  using IsTransparent = void;
+
+  template<ConvertibleTo<StringView> A, ConvertibleTo<StringView> B>
+  NODISCARD_ auto operator()(const A& a, const B& b) const -> bool {
+    return StringView(a) == StringView(b);
+  }
+};
+
+template<typename H, typename E>
+concept TransparentHashing = requires {
+  typename H::IsTransparent;
+  typename E::IsTransparent;
+};
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,300 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Busy-waiting locks, for code that has nothing to block on.
+*
+* SpinLock:   test-and-test-and-set. cheapest when uncontended, but
+*             unfair, and every release makes all waiters race for the line.
+* TicketLock: FIFO order, waiters back off in proportion to their
+*             distance from the front. still spins on a shared line.
+* McsLock:    every waiter spins on its own queue node, so a release
+*             only touches the next waiter's line. holds up best under
+*             heavy contention, at the cost of a node per acquisition.
+*
+* each lock takes a statistics policy. NoLockStats compiles to nothing,
+* LockStats counts acquisitions, contended acquisitions and spins.
+*
+* OnceFlag runs an initializer exactly once, for lazily filled globals:
+* threads that lose the race to run it wait until it's done.
+*/
+
+struct NoLockStats {
+  FORCEINLINE_ auto record(UNUSED_ bool contended, UNUSED_ uint64 spins) -> void {}
+};
+
+struct LockStats {
+  auto record(bool contended, uint64 spins) -> void {
+    acquisitions.fetch_add(1, MemoryOrder::Relaxed);
+    if(contended) {
+      contended_acquisitions.fetch_add(1, MemoryOrder::Relaxed);
+      total_spins.fetch_add(spins, MemoryOrder::Relaxed);
+    }
+  }
+
+  auto reset() -> void {
+    acquisitions.store(0, MemoryOrder::Relaxed);
+    contended_acquisitions.store(0, MemoryOrder::Relaxed);
+    total_spins.store(0, MemoryOrder::Relaxed);
+  }
+
+  Atomic<uint64> acquisitions;
+  Atomic<uint64> contended_acquisitions;
+  Atomic<uint64> total_spins;
+};
+
+template<typename Stats = NoLockStats>
+class SpinLock_ {
+  KTA_MAKE_NONCOPYABLE(SpinLock_);
+  KTA_MAKE_NONMOVABLE(SpinLock_);
+public:
+  auto lock() -> void {
+    if(!locked_.exchange(true, MemoryOrder::Acquire)) [[likely]] {
+      stats_.record(false, 0);
+      return;
+    }
+
+    Backoff backoff;
+    uint64 spins = 0;
+    do {
+      /// Wait on a plain load, so the line stays shared while the lock is held.
+      while(locked_.load(MemoryOrder::Relaxed)) {
+        backoff.spin();
+        ++spins;
+      }
+    } while(locked_.exchange(true, MemoryOrder::Acquire));
+
+    stats_.record(true, spins);
+  }
+
+  NODISCARD_ auto try_lock() -> bool {
+    if(locked_.load(MemoryOrder::Relaxed)) return false;
+    if(locked_.exchange(true, MemoryOrder::Acquire)) return false;
+    stats_.record(false, 0);
+    return true;
+  }
+
+  auto unlock() -> void {
+    locked_.store(false, MemoryOrder::Release);
+  }
+
+  NODISCARD_ auto is_locked() const -> bool { return locked_.load(MemoryOrder::Relaxed); }
+  NODISCARD_ auto stats() const -> const Stats& { return stats_; }
+
+  SpinLock_() = default;
+private:
+  Atomic<bool> locked_;
+  [[no_unique_address]] Stats stats_;
+};
+
+template<typename Stats = NoLockStats>
+class TicketLock_ {
+  KTA_MAKE_NONCOPYABLE(TicketLock_);
+  KTA_MAKE_NONMOVABLE(TicketLock_);
+public:
+  auto lock() -> void {
+    const uint32 ticket = next_.fetch_add(1, MemoryOrder::Relaxed);
+    uint32 serving = serving_.load(MemoryOrder::Acquire);
+    if(serving == ticket) [[likely]] {
+      stats_.record(false, 0);
+      return;
+    }
+
+    /// Each waiter ahead of us will hold the lock for a while,
+    /// there is no point in polling much more often than that.
+    /// If the line doesn't move at all, the thread whose turn it is
+    /// has probably been preempted: yield so it can run.
+    uint64 spins = 0;
+    do {
+      const uint32 ahead = ticket - serving;
+      if(spins < yield_after_) {
+        for(uint32 i = 0; i < ahead * spins_per_waiter_; i++) cpu_relax();
+        spins += ahead * spins_per_waiter_;
+      } else {
+        thread_yield();
+        ++spins;
+      }
+
+      serving = serving_.load(MemoryOrder::Acquire);
+    } while(serving != ticket);
+
+    stats_.record(true, spins);
+  }
+
+  NODISCARD_ auto try_lock() -> bool {
+    const uint32 serving = serving_.load(MemoryOrder::Relaxed);
+    uint32 expected = serving;
+    if(!next_.compare_exchange_strong(expected, serving + 1, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+      return false;
+
+    stats_.record(false, 0);
+    return true;
+  }
+
+  /// Only the holder writes serving_, so no read-modify-write is needed.
+  auto unlock() -> void {
+    serving_.store(serving_.load(MemoryOrder::Relaxed) + 1, MemoryOrder::Release);
+  }
+
+  NODISCARD_ auto is_locked() const -> bool {
+    return next_.load(MemoryOrder::Relaxed) != serving_.load(MemoryOrder::Relaxed);
+  }
+
+  NODISCARD_ auto stats() const -> const Stats& { return stats_; }
+
+  TicketLock_() = default;
+private:
+  constexpr static uint32 spins_per_waiter_ = 32;
+  constexpr static uint64 yield_after_      = 1 << 14;
+
+  Atomic<uint32> next_;
+  Atomic<uint32> serving_;
+  [[no_unique_address]] Stats stats_;
+};
+
+/// Queue node for McsLock_. Lives on the stack of the thread
+/// acquiring the lock, and must stay put until it unlocks.
+struct alignas(cache_line_size) McsNode {
+  Atomic<McsNode*> next;
+  Atomic<uint32> locked;
+};
+
+template<typename Stats = NoLockStats>
+class McsLock_ {
+  KTA_MAKE_NONCOPYABLE(McsLock_);
+  KTA_MAKE_NONMOVABLE(McsLock_);
+public:
+  using Node = McsNode;
+
+  auto lock(Node& node) -> void {
+    node.next.store(nullptr, MemoryOrder::Relaxed);
+    node.locked.store(1, MemoryOrder::Relaxed);
+
+    Node* prev = tail_.exchange(&node, MemoryOrder::AcqRel);
+    if(prev == nullptr) [[likely]] {
+      stats_.record(false, 0);
+      return;
+    }
+
+    prev->next.store(&node, MemoryOrder::Release);
+
+    Backoff backoff;
+    uint64 spins = 0;
+    while(node.locked.load(MemoryOrder::Acquire)) {
+      backoff.spin();
+      ++spins;
+    }
+
+    stats_.record(true, spins);
+  }
+
+  NODISCARD_ auto try_lock(Node& node) -> bool {
+    node.next.store(nullptr, MemoryOrder::Relaxed);
+    Node* expected = nullptr;
+    if(!tail_.compare_exchange_strong(expected, &node, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+      return false;
+
+    stats_.record(false, 0);
+    return true;
+  }
+
+  auto unlock(Node& node) -> void {
+    Node* next = node.next.load(MemoryOrder::Acquire);
+    if(next == nullptr) {
+      Node* expected = &node;
+      if(tail_.compare_exchange_strong(expected, nullptr, MemoryOrder::Release, MemoryOrder::Relaxed))
+        return;
+
+      /// Someone swapped themselves in as the tail but hasn't linked up yet.
+      Backoff backoff;
+      while((next = node.next.load(MemoryOrder::Acquire)) == nullptr) backoff.spin();
+    }
+
+    next->locked.store(0, MemoryOrder::Release);
+  }
+
+  NODISCARD_ auto is_locked() const -> bool { return tail_.load(MemoryOrder::Relaxed) != nullptr; }
+  NODISCARD_ auto stats() const -> const Stats& { return stats_; }
+
+  McsLock_() = default;
+private:
+  Atomic<Node*> tail_;
+  [[no_unique_address]] Stats stats_;
+};
+
+using SpinLock   = SpinLock_<>;
+using TicketLock = TicketLock_<>;
+using McsLock    = McsLock_<>;
+
+/// Holds a lock for the duration of a scope.
+template<typename L>
+class LockGuard {
+  KTA_MAKE_NONCOPYABLE(LockGuard);
+  KTA_MAKE_NONMOVABLE(LockGuard);
+public:
+  explicit LockGuard(L& lock) : lock_(lock) { lock_.lock(); }
+  ~LockGuard() { lock_.unlock(); }
+private:
+  L& lock_;
+};
+
+/// MCS locks need a queue node, the guard provides it.
+template<typename Stats>
+class LockGuard<McsLock_<Stats>> {
+  KTA_MAKE_NONCOPYABLE(LockGuard);
+  KTA_MAKE_NONMOVABLE(LockGuard);
+public:
+  explicit LockGuard(McsLock_<Stats>& lock) : lock_(lock) { lock_.lock(node_); }
+  ~LockGuard() { lock_.unlock(node_); }
+private:
+  McsLock_<Stats>& lock_;
+  McsNode node_;
+};
+
+/// Once call() returns, fn has run to completion, on this thread or another.
+class OnceFlag {
+  KTA_MAKE_NONCOPYABLE(OnceFlag);
+  KTA_MAKE_NONMOVABLE(OnceFlag);
+public:
+  template<typename Fn>
+  FORCEINLINE_ auto call(Fn&& fn) -> void {
+    if(state_.load(MemoryOrder::Acquire) == done_) [[likely]] return;
+    call_slow_(fn);
+  }
+
+  NODISCARD_ auto is_done() const -> bool { return state_.load(MemoryOrder::Acquire) == done_; }
+
+  constexpr OnceFlag() = default;
+private:
+  static constexpr uint8 idle_    = 0;
+  static constexpr uint8 running_ = 1;
+  static constexpr uint8 done_    = 2;
+
+  template<typename Fn>
+  NOINLINE_ auto call_slow_(Fn& fn) -> void {
+    uint8 expected = idle_;
+    if(state_.compare_exchange_strong(expected, running_, MemoryOrder::Acquire, MemoryOrder::Acquire)) {
+      fn();
+      state_.store(done_, MemoryOrder::Release);
+      return;
+    }
+
+    Backoff backoff;
+    while(state_.load(MemoryOrder::Acquire) != done_) backoff.spin();
+  }
+
+  Atomic<uint8> state_{idle_};
+};
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,252 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Limits.hpp>
+#include <Kalantha/Core/Option.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Allocators/AllocatorBase.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Bounded multi-producer multi-consumer queue (Dmitry Vyukov's design).
+*
+* every cell carries a sequence number telling whose turn it is:
+* seq == pos means the cell is free for the producer claiming position
+* pos, seq == pos + 1 means it holds the element for the consumer
+* claiming pos. producers and consumers each contend on a single
+* counter, and only ever with their own kind.
+*
+* the queue is not lock-free in the strictest sense: a thread that
+* claims a cell and then stalls before publishing it holds up the
+* consumer of that one cell. in exchange, an operation is a single CAS.
+*
+* until init() succeeds the queue points at a shared sentinel cell
+* whose sequence number never matches, so it behaves as if it had no
+* capacity at all: every push fails and every pop comes back empty.
+*/
+
+template<Concrete T, typename Alloc = BumpAllocator>
+class MpmcQueue {
+  KTA_MAKE_NONCOPYABLE(MpmcQueue);
+  KTA_MAKE_NONMOVABLE(MpmcQueue);
+public:
+  using ValueType = T;
+
+  /// Allocates the cells. The capacity must be a power of two.
+  /// Must be called once, before the queue is shared.
+  auto init(usize capacity) -> Result<void, Error> {
+    if(cells_ != unset_cell_())
+      return Error{"MpmcQueue: already initialized!", ErrC::InvalidArg};
+    if(capacity < 2 || (capacity & (capacity - 1)) != 0)
+      return Error{"MpmcQueue: capacity must be a power of two!", ErrC::InvalidArg};
+    if(alloc_ == nullptr || capacity > NumericLimits<usize>::max() / sizeof(Cell_))
+      return Error{"MpmcQueue: allocation failure!", ErrC::NoMemory};
+
+    void* block = alloc_->allocate_bytes(alignof(Cell_), capacity * sizeof(Cell_));
+    if(block == nullptr) return Error{"MpmcQueue: allocation failure!", ErrC::NoMemory};
+
+    cells_ = static_cast<Cell_*>(block);
+    mask_  = capacity - 1;
+    for(usize i = 0; i < capacity; i++) {
+      kta::construct_at<Cell_>(cells_ + i, i);
+    }
+
+    return Result<void, Error>::create();
+  }
+
+  template<typename ...Args>
+  auto try_emplace(Args&&... args) -> bool {
+    usize pos = enqueue_pos_.load(MemoryOrder::Relaxed);
+    Cell_* cell;
+
+    for(;;) {
+      cell = &cells_[pos & mask_];
+      const usize seq = cell->seq.load(MemoryOrder::Acquire);
+      const auto diff = static_cast<ptrdiff>(seq - pos);
+      if(diff == 0) {
+        if(enqueue_pos_.compare_exchange_weak(pos, pos + 1, MemoryOrder::Relaxed)) break;
+      } else if(diff < 0) {
+        return false; /// full
+      } else {
+        pos = enqueue_pos_.load(MemoryOrder::Relaxed);
+      }
+    }
+
+    kta::construct_at<T>(cell->value(), kta::forward<Args>(args)...);
+    cell->seq.store(pos + 1, MemoryOrder::Release);
+    return true;
+  }
+
+  auto try_push(const T& value) -> bool { return try_emplace(value); }
+  auto try_push(T&& value)      -> bool { return try_emplace(kta::move(value)); }
+
+  NODISCARD_ auto try_pop() -> Option<T> {
+    usize pos = dequeue_pos_.load(MemoryOrder::Relaxed);
+    Cell_* cell;
+
+    for(;;) {
+      cell = &cells_[pos & mask_];
+      const usize seq = cell->seq.load(MemoryOrder::Acquire);
+      const auto diff = static_cast<ptrdiff>(seq - (pos + 1));
+      if(diff == 0) {
+        if(dequeue_pos_.compare_exchange_weak(pos, pos + 1, MemoryOrder::Relaxed)) break;
+      } else if(diff < 0) {
+        return {}; /// empty
+      } else {
+        pos = dequeue_pos_.load(MemoryOrder::Relaxed);
+      }
+    }
+
+    Option<T> out(kta::move(*cell->value()));
+    kta::destroy_at<T>(cell->value());
+    cell->seq.store(pos + mask_ + 1, MemoryOrder::Release);
+    return out;
+  }
+
+  /// Claims a run of consecutive free cells with a single CAS and copies
+  /// values into them. Returns the number of elements pushed, which may be
+  /// less than values.size() if the queue fills up.
+  auto push_batch(Span<const T> values) -> usize {
+    usize pos = enqueue_pos_.load(MemoryOrder::Relaxed);
+    usize count;
+
+    for(;;) {
+      count = 0;
+      while(count < values.size() && count <= mask_) {
+        const usize seq = cells_[(pos + count) & mask_].seq.load(MemoryOrder::Acquire);
+        if(seq != pos + count) break;
+        ++count;
+      }
+
+      if(count == 0) {
+        const usize seq = cells_[pos & mask_].seq.load(MemoryOrder::Acquire);
+        if(static_cast<ptrdiff>(seq - pos) < 0) return 0;
+        pos = enqueue_pos_.load(MemoryOrder::Relaxed);
+        continue;
+      }
+
+      if(enqueue_pos_.compare_exchange_weak(pos, pos + count, MemoryOrder::Relaxed)) break;
+    }
+
+    for(usize i = 0; i < count; i++) {
+      Cell_* cell = &cells_[(pos + i) & mask_];
+      kta::construct_at<T>(cell->value(), values[i]);
+      cell->seq.store(pos + i + 1, MemoryOrder::Release);
+    }
+
+    return count;
+  }
+
+  /// Claims a run of consecutive full cells with a single CAS and moves
+  /// them into out. Returns the number of elements popped.
+  auto pop_batch(Span<T> out) -> usize {
+    usize pos = dequeue_pos_.load(MemoryOrder::Relaxed);
+    usize count;
+
+    for(;;) {
+      count = 0;
+      while(count < out.size() && count <= mask_) {
+        const usize seq = cells_[(pos + count) & mask_].seq.load(MemoryOrder::Acquire);
+        if(seq != pos + count + 1) break;
+        ++count;
+      }
+
+      if(count == 0) {
+        const usize seq = cells_[pos & mask_].seq.load(MemoryOrder::Acquire);
+        if(static_cast<ptrdiff>(seq - (pos + 1)) < 0) return 0;
+        pos = dequeue_pos_.load(MemoryOrder::Relaxed);
+        continue;
+      }
+
+      if(dequeue_pos_.compare_exchange_weak(pos, pos + count, MemoryOrder::Relaxed)) break;
+    }
+
+    for(usize i = 0; i < count; i++) {
+      Cell_* cell = &cells_[(pos + i) & mask_];
+      out[i] = kta::move(*cell->value());
+      kta::destroy_at<T>(cell->value());
+      cell->seq.store(pos + i + mask_ + 1, MemoryOrder::Release);
+    }
+
+    return count;
+  }
+
+  NODISCARD_ auto capacity() const -> usize {
+    return cells_ != unset_cell_() ? mask_ + 1 : 0;
+  }
+
+  /// Only a snapshot when called while other threads are active.
+  NODISCARD_ auto size_approx() const -> usize {
+    const usize deq = dequeue_pos_.load(MemoryOrder::Acquire);
+    const usize enq = enqueue_pos_.load(MemoryOrder::Acquire);
+    return enq > deq ? enq - deq : 0;
+  }
+
+  explicit MpmcQueue(Alloc* alloc) : alloc_(alloc) {}
+  MpmcQueue() = default;
+
+  /// Destroys what is left and frees the cells, back to the state
+  /// before init(). Must not race with any other operation.
+  auto reset() -> void {
+    if(cells_ == unset_cell_()) return;
+    if constexpr(!IsTriviallyDestructible<T>) {
+      const usize enq = enqueue_pos_.load(MemoryOrder::Relaxed);
+      for(usize pos = dequeue_pos_.load(MemoryOrder::Relaxed); pos != enq; pos++) {
+        Cell_& cell = cells_[pos & mask_];
+        if(cell.seq.load(MemoryOrder::Relaxed) == pos + 1) kta::destroy_at<T>(cell.value());
+      }
+    }
+
+    UNUSED_ auto res = alloc_->deallocate_bytes(cells_, (mask_ + 1) * sizeof(Cell_));
+    cells_ = unset_cell_();
+    mask_  = 0;
+    enqueue_pos_.store(0, MemoryOrder::Relaxed);
+    dequeue_pos_.store(0, MemoryOrder::Relaxed);
+  }
+
+  /// Must not race with any other operation.
+  ~MpmcQueue() { reset(); }
+private:
+  struct Cell_ {
+    Atomic<usize> seq;
+    alignas(T) uint8 storage[sizeof(T)];
+
+    NODISCARD_ FORCEINLINE_ auto value() -> T* { return reinterpret_cast<T*>(&storage[0]); }
+    /// storage is zeroed only so the sentinel can be constant initialized.
+    constexpr explicit Cell_(usize s) : seq(s), storage{} {}
+  };
+
+  /// Never written: with both positions stuck at 0, producers see
+  /// seq - pos < 0 (full) and consumers seq - (pos + 1) < 0 (empty).
+  static constinit inline Cell_ unset_cell_storage_{NumericLimits<usize>::max()};
+
+  NODISCARD_ FORCEINLINE_ static auto unset_cell_() -> Cell_* { return &unset_cell_storage_; }
+
+  /// Producers.
+  alignas(cache_line_size) Atomic<usize> enqueue_pos_;
+
+  /// Consumers.
+  alignas(cache_line_size) Atomic<usize> dequeue_pos_;
+
+  /// Read-only after init(), shared by everyone.
+  alignas(cache_line_size) Cell_* cells_ = unset_cell_();
+  usize mask_   = 0;
+  Alloc* alloc_ = nullptr;
+};
+
+END_NAMESPACE_KTA_
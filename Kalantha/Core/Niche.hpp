@@ -0,0 +1,51 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Niches: bit patterns a type can hold that are never a valid value.
+*
+* Option_ keeps its empty state in the niche of a type that has one,
+* instead of in a separate bool, so e.g. an Option<T*> is the size of
+* a pointer. a type opts in by specializing NicheTraits with
+*
+*   static constexpr bool has_niche = true;
+*   static auto niche() -> T;                  /// a T holding the pattern.
+*   static auto is_niche(const T& value) -> bool;
+*
+* the type has to be trivially destructible, and nothing but Option_
+* should ever hand out a T holding its niche.
+*/
+
+template<typename T>
+struct NicheTraits {
+  static constexpr bool has_niche = false;
+};
+
+template<typename T>
+concept HasNiche = NicheTraits<T>::has_niche;
+
+/// No object can sit at the very last address, so no pointer to one
+/// is all ones. nullptr stays a value: Option<T*>(nullptr) is not empty.
+template<typename T>
+struct NicheTraits<T*> {
+  static constexpr bool has_niche = true;
+
+  NODISCARD_ FORCEINLINE_ static auto niche() -> T* {
+    return reinterpret_cast<T*>(~uintptr(0));
+  }
+
+  NODISCARD_ FORCEINLINE_ static auto is_niche(T* const& value) -> bool {
+    return reinterpret_cast<uintptr>(value) == ~uintptr(0);
+  }
+};
+
+END_NAMESPACE_KTA_
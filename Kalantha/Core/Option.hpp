@@ -14,65 +14,83 @@
 #include <Kalantha/Core/Memory.hpp>
 #include <Kalantha/Core/ClassTraits.hpp>
 #include <Kalantha/Core/DummyTypes.hpp>
+#include <Kalantha/Core/Niche.hpp>
 BEGIN_NAMESPACE_KTA_
 
+BEGIN_NAMESPACE(detail_);
+
+/// The separate engaged flag, for types without a niche.
+template<bool niche_>
+struct OptionFlag_ {
+  bool has_value_ = false;
+};
+
+template<>
+struct OptionFlag_<true> {};
+
+END_NAMESPACE(detail_);
+
+/// Types with a niche (see Niche.hpp) keep the empty state in it, and an
+/// Option_ of them is no bigger than the type itself. Others use a bool.
 template <Concrete T>
 class Option_ {
+  constexpr static bool has_niche_ = HasNiche<T>;
+  static_assert(!has_niche_ || TrivialDTOR<T>, "Option_: types with a niche must be trivially destructible");
 public:
   using ValueType     = T;
   using ReferenceType = T&;
   using PointerType   = T*;
 
   NODISCARD_ FORCEINLINE_ auto value() & -> ReferenceType {
-    KTA_ASSERT(has_value_, "Option_ has no contained type!");
+    KTA_ASSERT(has_value(), "Option_ has no contained type!");
     return *kta::launder<T>(reinterpret_cast<T*>(&value_));
   }
 
   NODISCARD_ FORCEINLINE_ auto value() const& -> const T& {
-    KTA_ASSERT(has_value_, "Option_ has no contained type!");
+    KTA_ASSERT(has_value(), "Option_ has no contained type!");
     return *kta::launder<const T>(reinterpret_cast<const T*>(&value_));
   }
 
   NODISCARD_ FORCEINLINE_ auto value() && -> ValueType {
-    KTA_ASSERT(has_value_, "Option_ has no contained type!");
+    KTA_ASSERT(has_value(), "Option_ has no contained type!");
     return release_value(); /// rvalues should release the contained type.
   }                         ///
 
   auto operator->(this auto&& self) -> decltype(auto) {
-    KTA_ASSERT(self.has_value_, "Option_ has no contained type!");
+    KTA_ASSERT(self.has_value(), "Option_ has no contained type!");
     return &self.value();
   }
 
   auto operator*(this auto&& self) -> decltype(auto) {
-    KTA_ASSERT(self.has_value_, "Option_ has no contained type!");
+    KTA_ASSERT(self.has_value(), "Option_ has no contained type!");
     return self.value();
   }
 
   FORCEINLINE_ auto release_value() -> ValueType {
-    KTA_ASSERT(has_value_, "Option_ has no contained type!");
+    KTA_ASSERT(has_value(), "Option_ has no contained type!");
     T released = kta::move( value() );
     value().~T();           /// We'll have to manually call the destructor.
-    has_value_ = false;     ///
+    set_empty_();           ///
     return released;
   }
 
   FORCEINLINE_ auto clear() -> void {
-    if(has_value_)
+    if(has_value())
       value().~T();
-    has_value_ = false;
+    set_empty_();
   }
 
   FORCEINLINE_ auto value_or(T&& other) const -> ValueType {
-    if(has_value_) return value();
+    if(has_value()) return value();
     return other;
   }
 
   FORCEINLINE_ auto operator=(Option_&& other) noexcept -> Option_& {
     if(&other == this) return *this;
     clear();
-    if(other.has_value_) {
-      has_value_ = true;
+    if(other.has_value()) {
       kta::construct_at<T>(&value_, other.release_value());
+      set_engaged_();
     }
 
     return *this;
@@ -81,9 +99,9 @@ public:
   FORCEINLINE_ auto operator=(const Option_& other) -> Option_& {
     if(&other == this) return *this;
     clear();
-    if(other.has_value_) {
-      has_value_ = true;
+    if(other.has_value()) {
       kta::construct_at<T>(&value_, other.value());
+      set_engaged_();
     }
 
     return *this;
@@ -92,8 +110,8 @@ public:
   template<typename ...Args>
   FORCEINLINE_ auto emplace(Args&&... args) -> void {
     clear();
-    has_value_ = true;
     kta::construct_at<T>(&value_, kta::forward<Args>(args)...);
+    set_engaged_();
   }
 
   template<typename ...Args>
@@ -104,29 +122,61 @@ public:
   template<typename ...Args> requires Constructs<T, Args...>
   FORCEINLINE_ Option_(Args&&... args) {
     kta::construct_at<T>(&value_, kta::forward<Args>(args)...);
-    has_value_ = true;
+    set_engaged_();
   }
 
   FORCEINLINE_ Option_(const Option_& other) {
-    if(!other.has_value_) return;
+    if(!other.has_value()) {
+      set_empty_();
+      return;
+    }
+
     kta::construct_at<T>( &value_, other.value() );
-    has_value_ = true;
+    set_engaged_();
   }
 
   FORCEINLINE_ Option_(Option_&& other) {
-    if(!other.has_value_) return;
+    if(!other.has_value()) {
+      set_empty_();
+      return;
+    }
+
     kta::construct_at<T>( &value_, other.release_value() );
-    has_value_ = true;
+    set_engaged_();
   }
 
-  auto has_value() const -> bool { return has_value_; }
-  explicit operator bool() const { return has_value_; }
+  FORCEINLINE_ auto has_value() const -> bool {
+    if constexpr(has_niche_) {
+      return !NicheTraits<T>::is_niche(*kta::launder<const T>(reinterpret_cast<const T*>(&value_)));
+    } else {
+      return flag_.has_value_;
+    }
+  }
+
+  explicit operator bool() const { return has_value(); }
 
-  Option_() = default;
-  Option_(const None_&) {}
+  Option_() { set_empty_(); }
+  Option_(const None_&) { set_empty_(); }
  ~Option_() { clear(); }
 private:
-  bool has_value_{false};
+  /// With a niche, the storage always holds a T: either a value or the niche.
+  FORCEINLINE_ auto set_empty_() -> void {
+    if constexpr(has_niche_) {
+      kta::construct_at<T>(&value_, NicheTraits<T>::niche());
+    } else {
+      flag_.has_value_ = false;
+    }
+  }
+
+  FORCEINLINE_ auto set_engaged_() -> void {
+    if constexpr(has_niche_) {
+      KTA_ASSERT(has_value(), "Option_: the value is the type's niche!");
+    } else {
+      flag_.has_value_ = true;
+    }
+  }
+
+  [[no_unique_address]] detail_::OptionFlag_<has_niche_> flag_;
   alignas(T) uint8 value_[ sizeof(T) ]{};
 };
 
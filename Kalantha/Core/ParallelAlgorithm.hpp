@@ -0,0 +1,297 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Algorithm.hpp>
+#include <Kalantha/Core/Scheduler.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Execution policies for the Span algorithms in Algorithm.hpp.
+*
+* kta::seq runs the plain sequential loop. kta::par(scheduler) splits
+* the range into blocks and runs them on the scheduler's workers, each
+* block with the same sequential loop. ranges no bigger than one grain
+* aren't worth a fork and run inline.
+*
+* reduce and inclusive_scan need one partial result per block, kept on
+* the stack, so the number of blocks is capped: very large ranges get
+* proportionally larger blocks rather than more of them.
+*
+* sort is pdqsort with the two sides of every partition sorted in
+* parallel, down to one block's worth of elements. comp gets called
+* from several threads at once.
+*/
+
+struct SequencedPolicy {};
+
+struct ParallelPolicy {
+  Scheduler* scheduler = nullptr;
+  usize grain = 0; /// 0: picked from the worker count and the range size.
+};
+
+inline constexpr SequencedPolicy seq{};
+
+NODISCARD_ inline auto par(Scheduler& scheduler, usize grain = 0) -> ParallelPolicy {
+  return ParallelPolicy{&scheduler, grain};
+}
+
+template<typename P>
+concept ExecutionPolicy = IsSame<P, SequencedPolicy> || IsSame<P, ParallelPolicy>;
+
+BEGIN_NAMESPACE(detail_);
+
+constexpr usize max_parallel_blocks_ = 256;
+
+struct BlockPlan_ {
+  usize count = 1;
+  usize size  = 0;
+};
+
+NODISCARD_ inline auto plan_blocks_(const ParallelPolicy& policy, usize n) -> BlockPlan_ {
+  if(policy.scheduler == nullptr || n == 0) return BlockPlan_{1, n};
+  const usize grain = policy.grain != 0 ? policy.grain : default_grain_size(*policy.scheduler, n);
+
+  usize count = (n + grain - 1) / grain;
+  if(count > max_parallel_blocks_) count = max_parallel_blocks_;
+  const usize size = (n + count - 1) / count;
+  return BlockPlan_{(n + size - 1) / size, size};
+}
+
+/// One result per block, constructed by the block itself,
+/// so U doesn't have to be default constructible.
+template<typename U>
+class BlockResults_ {
+  KTA_MAKE_NONCOPYABLE(BlockResults_);
+  KTA_MAKE_NONMOVABLE(BlockResults_);
+public:
+  auto construct(usize block, U&& value) -> void {
+    kta::construct_at<U>(data() + block, kta::move(value));
+  }
+
+  NODISCARD_ auto data() -> U* { return reinterpret_cast<U*>(storage_); }
+  NODISCARD_ auto operator[](usize block) -> U& { return data()[block]; }
+
+  /// count: how many blocks construct their result before this goes out of scope.
+  explicit BlockResults_(usize count) : count_(count) {}
+  ~BlockResults_() {
+    for(usize i = 0; i < count_; i++) kta::destroy_at<U>(data() + i);
+  }
+private:
+  alignas(U) uint8 storage_[sizeof(U) * max_parallel_blocks_];
+  usize count_ = 0;
+};
+
+/// Calls fn(block, offset, length) for every block of the plan, in parallel.
+template<typename Fn>
+auto run_blocks_(Scheduler& sched, usize n, BlockPlan_ plan, Fn&& fn) -> void {
+  usize blocks[max_parallel_blocks_];
+  for(usize i = 0; i < plan.count; i++) blocks[i] = i;
+
+  parallel_for(sched, Span<usize>(blocks, plan.count), [&](usize& block) {
+    const usize offset = block * plan.size;
+    fn(block, offset, kta::min(plan.size, n - offset));
+  }, 1);
+}
+
+/// pdqsort_loop_, except that the left side of a partition is handed
+/// to another worker instead of being sorted first. Ranges of grain
+/// elements or fewer go to the sequential loop.
+template<bool branchless_, typename T, typename Comp>
+struct SortTask_ : Task {
+  T* begin;
+  T* end;
+  Comp* comp;
+  usize grain;
+  int bad_allowed;
+  bool leftmost;
+
+  SortTask_(T* b, T* e, Comp* c, usize g, int bad, bool left)
+    : Task(&run_), begin(b), end(e), comp(c), grain(g), bad_allowed(bad), leftmost(left) {}
+
+  static auto sort_(TaskContext& ctx, T* begin, T* end, Comp& comp, usize grain, int bad_allowed, bool leftmost) -> void {
+    usize size = static_cast<usize>(end - begin);
+    for(; size > grain && size >= insertion_sort_threshold_; size = static_cast<usize>(end - begin)) {
+      choose_pivot_(begin, end, comp);
+      if(leftmost || comp(*(begin - 1), *begin)) break;
+
+      /// A run of elements equal to the one before us, nothing to sort there.
+      begin    = partition_left_(begin, end, comp) + 1;
+      leftmost = false;
+    }
+
+    if(size <= grain || size < insertion_sort_threshold_) {
+      pdqsort_loop_<branchless_>(begin, end, comp, bad_allowed, leftmost);
+      return;
+    }
+
+    const PartitionResult_<T> part = branchless_
+      ? partition_right_branchless_(begin, end, comp)
+      : partition_right_(begin, end, comp);
+
+    T* pivot_pos = part.pivot;
+    const usize l_size = static_cast<usize>(pivot_pos - begin);
+    const usize r_size = static_cast<usize>(end - (pivot_pos + 1));
+
+    /// No pattern breaking here, a run of lopsided partitions
+    /// goes straight to the heap sort fallback.
+    if(l_size < size / 8 || r_size < size / 8) {
+      if(--bad_allowed == 0) {
+        heap_sort_(begin, end, comp);
+        return;
+      }
+    } else if(part.already_partitioned
+      && partial_insertion_sort_(begin, pivot_pos, comp)
+      && partial_insertion_sort_(pivot_pos + 1, end, comp)) {
+      return;
+    }
+
+    SortTask_ left(begin, pivot_pos, &comp, grain, bad_allowed, leftmost);
+    ctx.spawn(left);
+    sort_(ctx, pivot_pos + 1, end, comp, grain, bad_allowed, false);
+    ctx.wait(left);
+  }
+
+  static auto run_(Task& self, TaskContext& ctx) -> void {
+    auto& task = static_cast<SortTask_&>(self);
+    sort_(ctx, task.begin, task.end, *task.comp, task.grain, task.bad_allowed, task.leftmost);
+  }
+};
+
+END_NAMESPACE(detail_);
+
+template<ExecutionPolicy P, typename T, typename Fn>
+auto for_each(UNUSED_ const P& policy, Span<T> range, Fn&& fn) -> void {
+  if constexpr(IsSame<P, ParallelPolicy>) {
+    const auto plan = detail_::plan_blocks_(policy, range.size());
+    if(plan.count > 1) {
+      parallel_for_chunks(*policy.scheduler, range, [&fn](Span<T> chunk) {
+        kta::for_each(chunk, fn);
+      }, plan.size);
+      return;
+    }
+  }
+
+  kta::for_each(range, fn);
+}
+
+template<ExecutionPolicy P, typename T, typename U, typename Fn>
+auto transform(UNUSED_ const P& policy, Span<T> in, Span<U> out, Fn&& fn) -> Span<U> {
+  KTA_ASSERT(out.size() >= in.size(), "transform: output is too small");
+  if constexpr(IsSame<P, ParallelPolicy>) {
+    const auto plan = detail_::plan_blocks_(policy, in.size());
+    if(plan.count > 1) {
+      detail_::run_blocks_(*policy.scheduler, in.size(), plan, [&](usize, usize offset, usize length) {
+        kta::transform(in.subspan(offset, length), out.subspan(offset, length), fn);
+      });
+      return out.first(in.size());
+    }
+  }
+
+  return kta::transform(in, out, fn);
+}
+
+template<ExecutionPolicy P, typename T, typename U, typename Op>
+NODISCARD_ auto reduce(UNUSED_ const P& policy, Span<T> range, U init, Op&& op) -> U {
+  if constexpr(IsSame<P, ParallelPolicy>) {
+    const auto plan = detail_::plan_blocks_(policy, range.size());
+    if(plan.count > 1) {
+      detail_::BlockResults_<U> partials(plan.count);
+      detail_::run_blocks_(*policy.scheduler, range.size(), plan, [&](usize block, usize offset, usize length) {
+        partials.construct(block, detail_::reduce_nonempty_<U>(range.data() + offset, length, op));
+      });
+      return op(init, detail_::reduce_nonempty_<U>(partials.data(), plan.count, op));
+    }
+  }
+
+  return kta::reduce(range, init, op);
+}
+
+template<ExecutionPolicy P, typename T, typename U>
+NODISCARD_ auto reduce(UNUSED_ const P& policy, Span<T> range, U init) -> U {
+  return kta::reduce(policy, range, init, detail_::Plus_{});
+}
+
+/// Three passes: fold every block in order, scan the block totals, then
+/// scan every block again starting from the total of the ones before it.
+/// op only has to be associative, like for the sequential version.
+template<ExecutionPolicy P, typename T, typename U, typename Op>
+auto inclusive_scan(UNUSED_ const P& policy, Span<T> in, Span<U> out, Op&& op) -> Span<U> {
+  KTA_ASSERT(out.size() >= in.size(), "inclusive_scan: output is too small");
+  if constexpr(IsSame<P, ParallelPolicy>) {
+    const auto plan = detail_::plan_blocks_(policy, in.size());
+    if(plan.count > 1) {
+      detail_::BlockResults_<U> carry(plan.count - 1);
+      detail_::run_blocks_(*policy.scheduler, in.size(), plan, [&](usize block, usize offset, usize length) {
+        if(block + 1 < plan.count) carry.construct(block, detail_::fold_nonempty_<U>(in.data() + offset, length, op));
+      });
+
+      /// carry[b] becomes the total of blocks 0..b.
+      detail_::scan_from_(carry.data() + 1, carry.data() + 1, plan.count - 2, carry[0], op);
+      detail_::run_blocks_(*policy.scheduler, in.size(), plan, [&](usize block, usize offset, usize length) {
+        if(block == 0) kta::inclusive_scan(in.first(length), out.first(length), op);
+        else detail_::scan_from_(in.data() + offset, out.data() + offset, length, carry[block - 1], op);
+      });
+      return out.first(in.size());
+    }
+  }
+
+  return kta::inclusive_scan(in, out, op);
+}
+
+template<ExecutionPolicy P, typename T, typename U>
+auto inclusive_scan(UNUSED_ const P& policy, Span<T> in, Span<U> out) -> Span<U> {
+  return kta::inclusive_scan(policy, in, out, detail_::Plus_{});
+}
+
+template<ExecutionPolicy P, typename T, typename Pred>
+NODISCARD_ auto count_if(UNUSED_ const P& policy, Span<T> range, Pred&& pred) -> usize {
+  if constexpr(IsSame<P, ParallelPolicy>) {
+    const auto plan = detail_::plan_blocks_(policy, range.size());
+    if(plan.count > 1) {
+      usize counts[detail_::max_parallel_blocks_];
+      detail_::run_blocks_(*policy.scheduler, range.size(), plan, [&](usize block, usize offset, usize length) {
+        counts[block] = kta::count_if(range.subspan(offset, length), pred);
+      });
+
+      usize total = 0;
+      for(usize i = 0; i < plan.count; i++) total += counts[i];
+      return total;
+    }
+  }
+
+  return kta::count_if(range, pred);
+}
+
+/// Unstable sort, see kta::sort.
+template<ExecutionPolicy P, typename T, typename Comp = Less<T>>
+auto sort(UNUSED_ const P& policy, Span<T> range, Comp&& comp = Comp{}) -> void {
+  if constexpr(IsSame<P, ParallelPolicy>) {
+    const auto plan = detail_::plan_blocks_(policy, range.size());
+    if(plan.count > 1) {
+      int bad_allowed = 0;
+      for(usize n = range.size(); n > 1; n >>= 1) ++bad_allowed;
+
+      using SortTask = detail_::SortTask_<detail_::sort_branchless_<T, Comp>, T, RemoveReference<Comp>>;
+      TaskContext ctx(*policy.scheduler, nullptr);
+      SortTask::sort_(ctx, range.data(), range.data() + range.size(), comp, plan.size, bad_allowed, true);
+      return;
+    }
+  }
+
+  kta::sort(range, comp);
+}
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,403 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Limits.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Core/Thread.hpp>
+#include <Kalantha/Core/MpmcQueue.hpp>
+#include <Kalantha/Core/WorkStealingDeque.hpp>
+#include <Kalantha/Allocators/AllocatorRef.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Fixed-size work-stealing thread pool.
+*
+* every worker owns a Chase-Lev deque. tasks spawned from inside a
+* task go to the bottom of the current worker's deque; idle workers
+* steal from the top of a random victim's. tasks submitted from outside
+* the pool go through a shared MPMC injection queue instead.
+*
+* tasks are never allocated by the scheduler: a Task is embedded in
+* whatever the caller wants to run and must stay alive until it is done.
+* TaskContext::wait() doesn't block, it keeps running other tasks
+* until the one being waited on completes, which is what makes nested
+* fork/join safe.
+*
+* workers with nothing to do spin briefly, then sleep on an epoch
+* counter that spawners only touch when someone is actually asleep.
+*/
+
+class Scheduler;
+class TaskContext;
+
+struct Task {
+  using Fn = void(*)(Task&, TaskContext&);
+
+  Fn fn = nullptr;
+  Atomic<uint32> done;
+
+  NODISCARD_ auto is_done() const -> bool { return done.load(MemoryOrder::Acquire) != 0; }
+
+  explicit Task(Fn f) : fn(f) {}
+  Task() = default;
+};
+
+BEGIN_NAMESPACE(detail_);
+
+struct alignas(cache_line_size) Worker_ {
+  WorkStealingDeque<Task*, AllocatorRef> deque;
+  ThreadHandle thread;
+  Scheduler* owner = nullptr;
+  uint64 rng       = 0;
+  usize index      = 0;
+
+  explicit Worker_(AllocatorRef* alloc) : deque(alloc) {}
+};
+
+END_NAMESPACE(detail_);
+
+/// Handed to every running task: lets it spawn children
+/// and wait for them, on whichever thread it happens to run.
+class TaskContext {
+public:
+  auto spawn(Task& task) -> void;
+  auto wait(Task& task) -> void;
+
+  NODISCARD_ auto scheduler() const -> Scheduler& { return *scheduler_; }
+
+  /// The current worker's index, or worker_count() for a thread outside the pool.
+  NODISCARD_ auto worker_index() const -> usize;
+
+  TaskContext(Scheduler& scheduler, detail_::Worker_* worker)
+    : scheduler_(&scheduler), worker_(worker) {}
+private:
+  Scheduler* scheduler_;
+  detail_::Worker_* worker_;
+};
+
+class Scheduler {
+  KTA_MAKE_NONCOPYABLE(Scheduler);
+  KTA_MAKE_NONMOVABLE(Scheduler);
+  friend class TaskContext;
+public:
+  struct Config {
+    usize workers        = 0;    /// 0: one per CPU, as reported by the platform.
+    usize deque_capacity = 1024;
+    usize queue_capacity = 1024;
+    bool pin_workers     = false;
+  };
+
+  /// Allocates the workers and starts their threads. A scheduler
+  /// is started once; the allocator has to outlive it. A start that
+  /// fails leaves nothing behind, and can be tried again.
+  template<typename Alloc>
+  auto start(Alloc* alloc, const Config& config, const ThreadPlatform& platform = default_thread_platform())
+    -> Result<void, Error>
+  {
+    if(alloc_.is_valid())
+      return Error{"Scheduler: already started!", ErrC::InvalidArg};
+    if(!platform.is_available())
+      return Error{"Scheduler: no thread platform!", ErrC::NotImplemented};
+
+    usize count = config.workers != 0 ? config.workers : platform.cpu_count();
+    if(count == 0) count = 1;
+
+    alloc_    = AllocatorRef(alloc);
+    platform_ = platform;
+    if(auto res = injected_.init(config.queue_capacity); !res.has_value()) {
+      unwind_start_();
+      return res;
+    }
+
+    void* block = alloc_.allocate_bytes(alignof(detail_::Worker_), count * sizeof(detail_::Worker_));
+    if(block == nullptr) {
+      unwind_start_();
+      return Error{"Scheduler: allocation failure!", ErrC::NoMemory};
+    }
+
+    workers_ = static_cast<detail_::Worker_*>(block);
+    for(usize i = 0; i < count; i++) {
+      detail_::Worker_* worker = kta::construct_at<detail_::Worker_>(workers_ + i, &alloc_);
+      worker->owner = this;
+      worker->index = i;
+      worker->rng   = 0x9E3779B97F4A7C15ULL * (i + 1);
+      ++worker_count_;
+
+      if(auto res = worker->deque.init(config.deque_capacity); !res.has_value()) {
+        stop();
+        unwind_start_();
+        return res;
+      }
+    }
+
+    pin_workers_ = config.pin_workers;
+    for(usize i = 0; i < count; i++) {
+      if(!platform_.spawn(workers_[i].thread, &Scheduler::worker_main_, &workers_[i])) {
+        stop_.store(true);
+        started_ = i;
+        stop();
+        unwind_start_();
+        return Error{"Scheduler: failed to spawn a worker thread!", ErrC::Generic};
+      }
+    }
+
+    started_ = count;
+    return Result<void, Error>::create();
+  }
+
+  /// Lets the workers drain what is still queued, then joins them.
+  auto stop() -> void {
+    if(workers_ == nullptr) return;
+
+    stop_.store(true);
+    epoch_.fetch_add(1);
+    epoch_.notify_all();
+    for(usize i = 0; i < started_; i++) platform_.join(workers_[i].thread);
+
+    for(usize i = 0; i < worker_count_; i++) kta::destroy_at<detail_::Worker_>(workers_ + i);
+    UNUSED_ auto res = alloc_.deallocate_bytes(workers_, worker_count_ * sizeof(detail_::Worker_));
+
+    workers_      = nullptr;
+    worker_count_ = 0;
+    started_      = 0;
+    stop_.store(false);
+  }
+
+  /// Queues a task from any thread. Falls back to running it
+  /// right here if the injection queue is full.
+  auto submit(Task& task) -> void {
+    TaskContext ctx(*this, nullptr);
+    ctx.spawn(task);
+  }
+
+  /// Waits for a task from outside the pool, running other tasks meanwhile.
+  auto wait(Task& task) -> void {
+    TaskContext ctx(*this, nullptr);
+    ctx.wait(task);
+  }
+
+  NODISCARD_ auto worker_count() const -> usize { return worker_count_; }
+  NODISCARD_ auto is_running()   const -> bool  { return workers_ != nullptr; }
+
+  Scheduler() : injected_(&alloc_) {}
+  ~Scheduler() { stop(); }
+private:
+  /// After stop(), undoes the rest of a start() that failed partway.
+  auto unwind_start_() -> void {
+    injected_.reset();
+    alloc_ = AllocatorRef();
+  }
+
+  static auto execute_(Task* task, TaskContext& ctx) -> void {
+    task->fn(*task, ctx);
+    task->done.store(1, MemoryOrder::Release);
+  }
+
+  /// Own deque first (LIFO, cache-warm), then steal (FIFO, big chunks
+  /// of work), then whatever came in from outside the pool.
+  NODISCARD_ auto find_work_(detail_::Worker_* self) -> Task* {
+    if(self != nullptr) {
+      if(auto task = self->deque.pop(); task.has_value()) return task.value();
+    }
+
+    if(worker_count_ != 0) {
+      uint64 r = self != nullptr ? self->rng : outside_seed_.fetch_add(0x9E3779B97F4A7C15ULL, MemoryOrder::Relaxed);
+      r ^= r << 13; r ^= r >> 7; r ^= r << 17;
+      if(self != nullptr) self->rng = r;
+
+      const usize start = static_cast<usize>(r % worker_count_);
+      for(usize i = 0; i < worker_count_; i++) {
+        detail_::Worker_& victim = workers_[(start + i) % worker_count_];
+        if(&victim == self) continue;
+        if(auto task = victim.deque.steal(); task.has_value()) return task.value();
+      }
+    }
+
+    if(auto task = injected_.try_pop(); task.has_value()) return task.value();
+    return nullptr;
+  }
+
+  auto wake_one_() -> void {
+    atomic_thread_fence(MemoryOrder::SeqCst);
+    if(sleepers_.load(MemoryOrder::Relaxed) != 0) {
+      epoch_.fetch_add(1, MemoryOrder::Release);
+      epoch_.notify_one();
+    }
+  }
+
+  static auto worker_main_(void* arg) -> void {
+    auto* self  = static_cast<detail_::Worker_*>(arg);
+    Scheduler& sched = *self->owner;
+    TaskContext ctx(sched, self);
+
+    if(sched.pin_workers_ && sched.platform_.pin_current != nullptr) {
+      const usize cpus = sched.platform_.cpu_count();
+      UNUSED_ bool pinned = sched.platform_.pin_current(cpus != 0 ? self->index % cpus : self->index);
+    }
+
+    uint32 idle = 0;
+    for(;;) {
+      if(Task* task = sched.find_work_(self)) {
+        execute_(task, ctx);
+        idle = 0;
+        continue;
+      }
+
+      if(sched.stop_.load(MemoryOrder::Acquire)) break;
+      if(++idle < idle_spins_) {
+        cpu_relax();
+        continue;
+      }
+
+      /// Announce ourselves before the final check, so a spawner
+      /// either sees us asleep or we see its task.
+      const uint32 epoch = sched.epoch_.load(MemoryOrder::Acquire);
+      sched.sleepers_.fetch_add(1);
+      atomic_thread_fence(MemoryOrder::SeqCst);
+
+      Task* task = sched.find_work_(self);
+      if(task == nullptr && !sched.stop_.load(MemoryOrder::Acquire)) {
+        sched.epoch_.wait(epoch);
+      }
+
+      sched.sleepers_.fetch_sub(1);
+      if(task != nullptr) execute_(task, ctx);
+      idle = 0;
+    }
+  }
+
+  constexpr static uint32 idle_spins_ = 1 << 10;
+
+  detail_::Worker_* workers_ = nullptr;
+  usize worker_count_ = 0;
+  usize started_      = 0;
+  bool pin_workers_   = false;
+  AllocatorRef alloc_;
+  ThreadPlatform platform_;
+  MpmcQueue<Task*, AllocatorRef> injected_;
+
+  alignas(cache_line_size) Atomic<uint32> epoch_;
+  Atomic<uint32> sleepers_;
+  Atomic<bool> stop_;
+  Atomic<uint64> outside_seed_;
+};
+
+inline auto TaskContext::spawn(Task& task) -> void {
+  task.done.store(0, MemoryOrder::Relaxed);
+  const bool queued = worker_ != nullptr
+    ? worker_->deque.push(&task)
+    : scheduler_->injected_.try_push(&task);
+
+  if(!queued) [[unlikely]] {
+    Scheduler::execute_(&task, *this);
+    return;
+  }
+
+  scheduler_->wake_one_();
+}
+
+inline auto TaskContext::wait(Task& task) -> void {
+  Backoff backoff;
+  while(!task.is_done()) {
+    if(Task* other = scheduler_->find_work_(worker_)) {
+      Scheduler::execute_(other, *this);
+      backoff.reset();
+    } else {
+      backoff.spin();
+    }
+  }
+}
+
+inline auto TaskContext::worker_index() const -> usize {
+  return worker_ != nullptr ? worker_->index : scheduler_->worker_count();
+}
+
+/*
+* Fork/join helpers.
+*/
+
+BEGIN_NAMESPACE(detail_);
+
+template<typename T, typename Body>
+struct RangeTask_ : Task {
+  Span<T> range;
+  Body* fn;
+  usize grain;
+
+  RangeTask_(Span<T> r, Body* f, usize g) : Task(&run_), range(r), fn(f), grain(g) {}
+
+  /// Split in half until we're down to the grain size, keeping the
+  /// left half and offering the right one to thieves. If nobody
+  /// steals it, we pop it right back and run it ourselves.
+  static auto split_run_(TaskContext& ctx, Span<T> range, Body* fn, usize grain) -> void {
+    if(range.size() <= grain) {
+      (*fn)(range);
+      return;
+    }
+
+    const usize half = range.size() / 2;
+    RangeTask_ right(range.subspan(half), fn, grain);
+    ctx.spawn(right);
+    split_run_(ctx, range.first(half), fn, grain);
+    ctx.wait(right);
+  }
+
+  static auto run_(Task& self, TaskContext& ctx) -> void {
+    auto& task = static_cast<RangeTask_&>(self);
+    split_run_(ctx, task.range, task.fn, task.grain);
+  }
+};
+
+END_NAMESPACE(detail_);
+
+/// Grain size used when none is given: about eight chunks per
+/// thread, enough for stealing to even out an uneven workload.
+NODISCARD_ inline auto default_grain_size(const Scheduler& sched, usize count) -> usize {
+  const usize chunks = (sched.worker_count() + 1) * 8;
+  const usize grain  = count / chunks;
+  return grain != 0 ? grain : 1;
+}
+
+/**
+ * @brief Calls fn on disjoint chunks of range, in parallel.
+ * @param ctx The context to fork from (a task's own, or one for an outside thread).
+ * @param range The elements to process.
+ * @param fn Called with chunks of at most grain elements.
+ * @param grain Chunk size, 0 to pick one based on the worker count.
+ */
+template<typename T, typename Fn>
+auto parallel_for_chunks(TaskContext& ctx, Span<T> range, Fn&& fn, usize grain = 0) -> void {
+  if(range.empty()) return;
+  if(grain == 0) grain = default_grain_size(ctx.scheduler(), range.size());
+  using Callable = RemoveReference<Fn>;
+  detail_::RangeTask_<T, Callable>::split_run_(ctx, range, &fn, grain);
+}
+
+template<typename T, typename Fn>
+auto parallel_for_chunks(Scheduler& sched, Span<T> range, Fn&& fn, usize grain = 0) -> void {
+  TaskContext ctx(sched, nullptr);
+  parallel_for_chunks(ctx, range, kta::forward<Fn>(fn), grain);
+}
+
+/// Calls fn on every element of range, in parallel.
+template<typename T, typename Fn>
+auto parallel_for(Scheduler& sched, Span<T> range, Fn&& fn, usize grain = 0) -> void {
+  parallel_for_chunks(sched, range, [&fn](Span<T> chunk) {
+    for(T& elem : chunk) fn(elem);
+  }, grain);
+}
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,166 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Core/Algorithm.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Search structures for static, read-mostly lookup tables.
+* kta::lower_bound and friends in Algorithm.hpp cover plain sorted arrays.
+*
+* Eytzinger layout stores a sorted array in BFS order of the implicit
+* binary search tree: the children of node k are 2k and 2k + 1. the
+* first few levels of every search hit the same handful of cache
+* lines, and a node's descendants four levels down (for 4-byte keys)
+* sit in one cache line, so one prefetch per step runs several
+* iterations ahead of the search. for tables
+* much larger than the cache this beats binary search on a sorted array
+* by a wide margin; for small ones the difference is noise.
+*
+* for really small arrays (a few dozen keys) nothing beats a linear
+* scan: counting the keys less than the needle over the whole array
+* is branch-free, and with AVX2 it's 4 or 8 keys per instruction.
+*/
+
+/// Writes sorted into out in Eytzinger order. out must hold
+/// sorted.size() + 1 elements: the layout is 1-based and out[0]
+/// is left alone. Records with a key work too, searched with a
+/// comparator that looks at the key.
+template<typename T, typename U>
+constexpr auto eytzinger_build(Span<T> sorted, Span<U> out) -> void {
+  KTA_ASSERT(out.size() >= sorted.size() + 1, "eytzinger_build: output is too small");
+  const usize n = sorted.size();
+  if(n == 0) return;
+
+  /// In-order walk of the implicit tree, starting at its leftmost node.
+  usize k = 1;
+  while(2 * k <= n) k *= 2;
+  for(usize i = 0; i < n; i++) {
+    out.data()[k] = sorted.data()[i];
+    if(2 * k + 1 <= n) {
+      k = 2 * k + 1;
+      while(2 * k <= n) k *= 2;
+    } else {
+      /// Climb while we're a right child; the successor is the parent
+      /// of the first left child on the way up.
+      k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+    }
+  }
+}
+
+/**
+ * @brief Searches a layout built by eytzinger_build().
+ * @param layout The whole 1-based layout, including the unused slot 0.
+ * @return The layout index of the first element not less than value,
+ *         or 0 if every element is less than value.
+ */
+template<typename T, typename U, typename Comp = Less<RemoveCV<T>>>
+NODISCARD_ auto eytzinger_lower_bound(Span<T> layout, const U& value, Comp&& comp = Comp{}) -> usize {
+  if(layout.size() < 2) return 0;
+  const usize n = layout.size() - 1;
+  const T* base = layout.data();
+
+  /// The descendants of k that many levels down are contiguous
+  /// from k * per_line; fetch them while we walk there.
+  constexpr usize per_line = sizeof(T) < cache_line_size ? cache_line_size / sizeof(T) : 1;
+  usize k = 1;
+  while(k <= n) {
+    __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<uintptr>(base) + k * per_line * sizeof(T)));
+    k = 2 * k + static_cast<usize>(comp(base[k], value));
+  }
+
+  /// Every right turn appended a 1 bit; undo the trailing ones
+  /// and the last left turn to get back to the answer.
+  k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+  return k;
+}
+
+template<typename T, typename U, typename Comp = Less<RemoveCV<T>>>
+NODISCARD_ auto eytzinger_contains(Span<T> layout, const U& value, Comp&& comp = Comp{}) -> bool {
+  const usize k = kta::eytzinger_lower_bound(layout, value, comp);
+  return k != 0 && !comp(value, layout.data()[k]);
+}
+
+BEGIN_NAMESPACE(detail_);
+
+template<typename T>
+NODISCARD_ constexpr auto count_less_scalar_(const T* data, usize n, const T& value) -> usize {
+  usize count = 0;
+  for(usize i = 0; i < n; i++) count += static_cast<usize>(data[i] < value);
+  return count;
+}
+
+#  if defined(ARCH_X86_64)
+template<typename T>
+concept SimdScanKey_ = IsIntegral<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+template<usize size_> struct SimdScanVec_;
+template<> struct SimdScanVec_<4> { using Vec = x86_64::Vec8i32; using Lane = int32;     };
+template<> struct SimdScanVec_<8> { using Vec = x86_64::Vec4i64; using Lane = long long; };
+
+/// Each lane subtracts its compare mask (all ones, i.e. -1, where
+/// data < value), so the accumulators count matches per lane.
+/// AVX2 only has signed compares: unsigned keys get their sign bit
+/// flipped on both sides first, which preserves their order.
+template<SimdScanKey_ T>
+KTA_TARGET_AVX2_ auto count_less_avx2_(const T* data, usize n, T value) -> usize {
+  using Vec  = typename SimdScanVec_<sizeof(T)>::Vec;
+  using Lane = typename SimdScanVec_<sizeof(T)>::Lane;
+  constexpr usize lanes = 32 / sizeof(T);
+  constexpr bool is_unsigned = static_cast<T>(-1) > static_cast<T>(0);
+  constexpr Lane bias = is_unsigned ? static_cast<Lane>(static_cast<MakeUnsigned<Lane>>(1) << (sizeof(T) * 8 - 1)) : 0;
+
+  const Vec needle = (Vec{} + static_cast<Lane>(value)) ^ bias;
+  Vec acc0 = {};
+  Vec acc1 = {};
+
+  usize i = 0;
+  for(; i + 2 * lanes <= n; i += 2 * lanes) {
+    Vec a, b;
+    __builtin_memcpy(&a, data + i, sizeof(Vec));
+    __builtin_memcpy(&b, data + i + lanes, sizeof(Vec));
+    acc0 -= (a ^ bias) < needle;
+    acc1 -= (b ^ bias) < needle;
+  }
+
+  acc0 += acc1;
+  usize count = 0;
+  for(usize lane = 0; lane < lanes; lane++) count += static_cast<usize>(acc0[lane]);
+  return count + count_less_scalar_(data + i, n - i, value);
+}
+#  endif
+
+END_NAMESPACE(detail_);
+
+/// Number of elements less than value, comparing every element.
+/// On a sorted span that's the same as lower_bound(); for a few
+/// dozen keys or less it's faster than any binary search. Uses
+/// AVX2 for 4 and 8 byte integer keys when the CPU has it.
+template<typename T>
+NODISCARD_ auto linear_lower_bound(Span<T> range, const RemoveCV<T>& value) -> usize {
+  using Key = RemoveCV<T>;
+#  if defined(ARCH_X86_64)
+  if constexpr(detail_::SimdScanKey_<Key>) {
+    if(simd_tier() >= SimdTier::Avx2) return detail_::count_less_avx2_<Key>(range.data(), range.size(), value);
+  }
+#  endif
+  return detail_::count_less_scalar_<Key>(range.data(), range.size(), value);
+}
+
+END_NAMESPACE_KTA_
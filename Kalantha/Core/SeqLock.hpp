@@ -0,0 +1,126 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Core/Locks.hpp>
+#include <Kalantha/Meta/TypeTraits.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Sequence lock, for small read-mostly values.
+*
+* writers bump the sequence number to an odd value, write, and bump it
+* again. readers copy the value out and retry if the sequence was odd
+* or changed in the meantime. readers never write to shared memory, so
+* any number of them can read concurrently without the cache line
+* ever leaving the shared state (until a writer comes along).
+*
+* the copy races with writers by design. to keep that well-defined it
+* is done in 64-bit relaxed atomic loads and stores, which is why T has
+* to be trivially copyable. a torn copy is thrown away, never returned.
+*/
+
+template<typename T>
+class SeqLock {
+  KTA_MAKE_NONCOPYABLE(SeqLock);
+  KTA_MAKE_NONMOVABLE(SeqLock);
+  static_assert(IsTriviallyCopyable<T>, "SeqLock requires a trivially copyable type");
+public:
+  using ValueType = T;
+
+  /// Single attempt. Returns false if a writer was active.
+  NODISCARD_ auto try_load(T& out) const -> bool {
+    const uint64 before = seq_.load(MemoryOrder::Acquire);
+    if(before & 1) return false;
+
+    uint64 copy[word_count_];
+    for(usize i = 0; i < word_count_; i++) {
+      copy[i] = __atomic_load_n(&words_[i], __ATOMIC_RELAXED);
+    }
+
+    /// Keeps the data loads above from sinking below the re-check.
+    atomic_thread_fence(MemoryOrder::Acquire);
+    if(seq_.load(MemoryOrder::Relaxed) != before) return false;
+
+    __builtin_memcpy(&out, copy, sizeof(T));
+    return true;
+  }
+
+  NODISCARD_ auto load() const -> T {
+    T out;
+    Backoff backoff;
+    while(!try_load(out)) backoff.spin();
+    return out;
+  }
+
+  /// Writers are serialized among themselves, readers are never blocked.
+  auto store(const T& value) -> void {
+    LockGuard guard(writer_lock_);
+    write_locked_(value);
+  }
+
+  /// Read-modify-write, without other writers getting in between.
+  template<typename Fn>
+  auto update(Fn&& fn) -> void {
+    LockGuard guard(writer_lock_);
+    T value = read_locked_();
+    fn(value);
+    write_locked_(value);
+  }
+
+  /// Odd while a write is in progress, grows by two with every store.
+  NODISCARD_ auto sequence() const -> uint64 {
+    return seq_.load(MemoryOrder::Acquire);
+  }
+
+  explicit SeqLock(const T& value) {
+    __builtin_memcpy(words_, &value, sizeof(T));
+  }
+
+  SeqLock() = default;
+private:
+  constexpr static usize word_count_ = (sizeof(T) + sizeof(uint64) - 1) / sizeof(uint64);
+
+  /// Called with writer_lock_ held: nobody else writes, no retry needed.
+  NODISCARD_ auto read_locked_() const -> T {
+    uint64 copy[word_count_];
+    for(usize i = 0; i < word_count_; i++) {
+      copy[i] = __atomic_load_n(&words_[i], __ATOMIC_RELAXED);
+    }
+
+    T out;
+    __builtin_memcpy(&out, copy, sizeof(T));
+    return out;
+  }
+
+  auto write_locked_(const T& value) -> void {
+    uint64 copy[word_count_]{};
+    __builtin_memcpy(copy, &value, sizeof(T));
+
+    const uint64 seq = seq_.load(MemoryOrder::Relaxed);
+    seq_.store(seq + 1, MemoryOrder::Relaxed);
+
+    /// The odd sequence must be visible before any of the new data.
+    atomic_thread_fence(MemoryOrder::Release);
+    for(usize i = 0; i < word_count_; i++) {
+      __atomic_store_n(&words_[i], copy[i], __ATOMIC_RELAXED);
+    }
+
+    seq_.store(seq + 2, MemoryOrder::Release);
+  }
+
+  /// Everything readers touch shares a line, the writer lock lives elsewhere.
+  alignas(cache_line_size) Atomic<uint64> seq_;
+  uint64 words_[word_count_]{};
+  alignas(cache_line_size) SpinLock writer_lock_;
+};
+
+END_NAMESPACE_KTA_
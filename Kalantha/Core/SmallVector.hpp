@@ -0,0 +1,275 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/Iterator.hpp>
+#include <Kalantha/Core/Assertions.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Limits.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+#include <Kalantha/Allocators/AllocatorBase.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* A vector that keeps up to inline_cap_ elements inside of itself,
+* and only touches the allocator once it runs out of room.
+*
+* the allocator is borrowed, not owned. a SmallVector with no allocator
+* is still perfectly usable, it just can't grow past inline_cap_.
+*/
+
+template<Concrete T, usize inline_cap_, typename Alloc = BumpAllocator>
+class SmallVector {
+  KTA_MAKE_NONCOPYABLE(SmallVector);
+public:
+  static_assert(IsBaseOf<AllocatorBase, Alloc>, "Alloc must derive from AllocatorBase!");
+
+  using ValueType     = RemoveCV<T>;
+  using Iterator      = KtaIterator<T>;
+  using ConstIterator = KtaIterator<AddConst<T>>;
+  using AllocatorType = Alloc;
+
+  constexpr static usize inline_capacity = inline_cap_;
+
+  NODISCARD_ auto data()       -> T*       { return data_; }
+  NODISCARD_ auto data() const -> const T* { return data_; }
+
+  NODISCARD_ Iterator begin() { return data_;         }
+  NODISCARD_ Iterator end()   { return data_ + size_; }
+
+  NODISCARD_ ConstIterator begin() const { return data_;         }
+  NODISCARD_ ConstIterator end()   const { return data_ + size_; }
+
+  NODISCARD_ auto size()      const -> usize { return size_;      }
+  NODISCARD_ auto capacity()  const -> usize { return cap_;       }
+  NODISCARD_ auto empty()     const -> bool  { return size_ == 0; }
+  NODISCARD_ auto is_inline() const -> bool  { return data_ == inline_data_(); }
+
+  NODISCARD_ auto allocator() const -> Alloc* { return alloc_; }
+
+  NODISCARD_ auto&& at(this auto&& self, usize i) {
+    KTA_ASSERT(i < self.size_, "Bounds check failure!");
+    return kta::forward<decltype(self)>(self).data_[ i ];
+  }
+
+  NODISCARD_ auto&& operator[](this auto&& self, usize i) {
+    return kta::forward<decltype(self)>(self).at(i);
+  }
+
+  NODISCARD_ auto&& front(this auto&& self) {
+    KTA_ASSERT(!self.empty(), "Empty SmallVector!");
+    return kta::forward<decltype(self)>(self).data_[ 0 ];
+  }
+
+  NODISCARD_ auto&& back(this auto&& self) {
+    KTA_ASSERT(!self.empty(), "Empty SmallVector!");
+    return kta::forward<decltype(self)>(self).data_[ self.size_ - 1 ];
+  }
+
+  NODISCARD_ auto span() -> Span<T> { return Span<T>(data_, size_); }
+  NODISCARD_ auto span() const -> Span<const T> { return Span<const T>(data_, size_); }
+
+  /// Constructs the new element directly in its final slot.
+  /// Panics if the vector needs to grow and the allocator can't provide,
+  /// and traps in builds where panics are compiled out.
+  template<typename ...Args>
+  FORCEINLINE_ auto emplace_back(Args&&... args) -> T& {
+    if(size_ == cap_) [[unlikely]] {
+      T* slot = grow_and_emplace_(kta::forward<Args>(args)...);
+      if(slot == nullptr) [[unlikely]] {
+        KTA_PANIC("SmallVector: allocation failure!");
+        __builtin_trap();
+      }
+      return *slot;
+    }
+
+    T* slot = kta::construct_at<T>(data_ + size_, kta::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+  }
+
+  /// Same as emplace_back(), but reports allocation failure instead.
+  template<typename ...Args>
+  FORCEINLINE_ auto try_emplace_back(Args&&... args) -> Result<void, Error> {
+    if(size_ == cap_) [[unlikely]] {
+      if(grow_and_emplace_(kta::forward<Args>(args)...) == nullptr)
+        return Error{"SmallVector: allocation failure!", ErrC::NoMemory};
+      return Result<void, Error>::create();
+    }
+
+    kta::construct_at<T>(data_ + size_, kta::forward<Args>(args)...);
+    ++size_;
+    return Result<void, Error>::create();
+  }
+
+  FORCEINLINE_ auto push_back(const T& value) -> T& { return emplace_back(value); }
+  FORCEINLINE_ auto push_back(T&& value)      -> T& { return emplace_back(kta::move(value)); }
+
+  FORCEINLINE_ auto pop_back() -> void {
+    KTA_ASSERT(!empty(), "Empty SmallVector!");
+    --size_;
+    kta::destroy_at<T>(data_ + size_);
+  }
+
+  auto clear() -> void {
+    if constexpr(!IsTriviallyDestructible<T>) {
+      for(usize i = 0; i < size_; i++) kta::destroy_at<T>(data_ + i);
+    }
+    size_ = 0;
+  }
+
+  auto reserve(usize new_cap) -> Result<void, Error> {
+    if(new_cap <= cap_) return Result<void, Error>::create();
+    if(extend_buffer_(new_cap)) return Result<void, Error>::create();
+
+    T* buff = allocate_buffer_(new_cap);
+    if(buff == nullptr) return Error{"SmallVector: allocation failure!", ErrC::NoMemory};
+
+    relocate_(data_, size_, buff);
+    release_buffer_();
+    data_ = buff;
+    cap_  = new_cap;
+    return Result<void, Error>::create();
+  }
+
+  /// Default-constructs new elements when growing, destroys trailing
+  /// elements when shrinking. The capacity is never reduced.
+  auto resize(usize new_size) -> Result<void, Error> {
+    if(new_size > cap_) {
+      auto res = reserve(next_capacity_(new_size));
+      if(!res.has_value()) return res;
+    }
+
+    for(; size_ > new_size; --size_) kta::destroy_at<T>(data_ + size_ - 1);
+    for(; size_ < new_size; ++size_) kta::construct_at<T>(data_ + size_);
+    return Result<void, Error>::create();
+  }
+
+  SmallVector(SmallVector&& other) : alloc_(other.alloc_) {
+    take_(kta::move(other));
+  }
+
+  auto operator=(SmallVector&& other) -> SmallVector& {
+    if(this != &other) {
+      clear();
+      release_buffer_();
+      data_  = inline_data_();
+      cap_   = inline_cap_;
+      alloc_ = other.alloc_;
+      take_(kta::move(other));
+    }
+
+    return *this;
+  }
+
+  explicit SmallVector(Alloc* alloc) : alloc_(alloc) {}
+  SmallVector() = default;
+
+  ~SmallVector() {
+    clear();
+    release_buffer_();
+  }
+private:
+  NODISCARD_ FORCEINLINE_ auto inline_data_() const -> T* {
+    return const_cast<T*>(reinterpret_cast<const T*>(&inline_[0]));
+  }
+
+  NODISCARD_ auto next_capacity_(usize required) const -> usize {
+    const usize doubled = cap_ > (NumericLimits<usize>::max() / 2) ? required : cap_ * 2;
+    const usize grown   = doubled < 4 ? 4 : doubled;
+    return grown < required ? required : grown;
+  }
+
+  NODISCARD_ auto allocate_buffer_(usize count) -> T* {
+    if(alloc_ == nullptr || count > NumericLimits<usize>::max() / sizeof(T))
+      return nullptr;
+    return static_cast<T*>(alloc_->allocate_bytes(alignof(T), count * sizeof(T)));
+  }
+
+  /// Grows the spilled buffer where it is, if the allocator can. For a
+  /// BumpAllocator that's the case whenever nothing was allocated after it.
+  NODISCARD_ auto extend_buffer_(usize new_cap) -> bool {
+    if(is_inline() || new_cap > NumericLimits<usize>::max() / sizeof(T))
+      return false;
+    if(!alloc_->extend_bytes(data_, cap_ * sizeof(T), new_cap * sizeof(T)))
+      return false;
+
+    cap_ = new_cap;
+    return true;
+  }
+
+  auto release_buffer_() -> void {
+    if(is_inline()) return;
+    UNUSED_ auto res = alloc_->deallocate_bytes(data_, cap_ * sizeof(T));
+  }
+
+  /// Moves count elements from src into uninitialized memory at dst,
+  /// ending the lifetime of the originals.
+  static auto relocate_(T* src, usize count, T* dst) -> void {
+    if constexpr(IsTriviallyCopyable<T>) {
+      if(count != 0) __builtin_memcpy(dst, src, count * sizeof(T));
+    } else {
+      for(usize i = 0; i < count; i++) {
+        kta::construct_at<T>(dst + i, kta::move(src[ i ]));
+        kta::destroy_at<T>(src + i);
+      }
+    }
+  }
+
+  /// The new element is built before anything is relocated:
+  /// args may very well refer to an element of this vector.
+  template<typename ...Args>
+  NOINLINE_ auto grow_and_emplace_(Args&&... args) -> T* {
+    const usize new_cap = next_capacity_(size_ + 1);
+    if(extend_buffer_(new_cap)) {
+      return kta::construct_at<T>(data_ + size_++, kta::forward<Args>(args)...);
+    }
+
+    T* buff = allocate_buffer_(new_cap);
+    if(buff == nullptr) return nullptr;
+
+    T* slot = kta::construct_at<T>(buff + size_, kta::forward<Args>(args)...);
+    relocate_(data_, size_, buff);
+    release_buffer_();
+
+    data_ = buff;
+    cap_  = new_cap;
+    ++size_;
+    return slot;
+  }
+
+  auto take_(SmallVector&& other) -> void {
+    if(other.is_inline()) {
+      relocate_(other.data_, other.size_, data_);
+      size_ = other.size_;
+    } else {
+      data_ = other.data_;
+      cap_  = other.cap_;
+      size_ = other.size_;
+      other.data_ = other.inline_data_();
+      other.cap_  = inline_cap_;
+    }
+
+    other.size_ = 0;
+  }
+
+  T* data_     = inline_data_();
+  usize size_  = 0;
+  usize cap_   = inline_cap_;
+  Alloc* alloc_ = nullptr;
+  alignas(T) uint8 inline_[ sizeof(T) * (inline_cap_ ? inline_cap_ : 1) ];
+};
+
+END_NAMESPACE_KTA_
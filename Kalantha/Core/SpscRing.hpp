@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/Utility.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Option.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Meta/Concepts.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Bounded, lock-free, single-producer single-consumer ring buffer.
+*
+* exactly one thread may push and exactly one (other) thread may pop.
+* the indices grow monotonically and are masked on access, so all
+* slots are usable and full/empty is simply tail - head.
+*
+* each side keeps a private copy of the other side's index and only
+* re-reads the shared one when the cached copy says the ring is
+* full (or empty). in the common case a push or pop touches nothing
+* but its own cache line and the slot itself.
+*/
+
+template<Concrete T, usize cap_>
+class SpscRing {
+  KTA_MAKE_NONCOPYABLE(SpscRing);
+  KTA_MAKE_NONMOVABLE(SpscRing);
+  static_assert(cap_ >= 2 && (cap_ & (cap_ - 1)) == 0, "SpscRing capacity must be a power of two");
+public:
+  using ValueType = T;
+
+  /// Producer side.
+  template<typename ...Args>
+  auto try_emplace(Args&&... args) -> bool {
+    const usize tail = tail_.load(MemoryOrder::Relaxed);
+    if(tail - cached_head_ == cap_) {
+      cached_head_ = head_.load(MemoryOrder::Acquire);
+      if(tail - cached_head_ == cap_) return false;
+    }
+
+    kta::construct_at<T>(slot_(tail), kta::forward<Args>(args)...);
+    tail_.store(tail + 1, MemoryOrder::Release);
+    return true;
+  }
+
+  auto try_push(const T& value) -> bool { return try_emplace(value); }
+  auto try_push(T&& value)      -> bool { return try_emplace(kta::move(value)); }
+
+  /// Copies as many elements as currently fit, publishing them all at once.
+  /// Returns the number of elements pushed.
+  auto push_batch(Span<const T> values) -> usize {
+    const usize tail = tail_.load(MemoryOrder::Relaxed);
+    usize free = cap_ - (tail - cached_head_);
+    if(free < values.size()) {
+      cached_head_ = head_.load(MemoryOrder::Acquire);
+      free = cap_ - (tail - cached_head_);
+    }
+
+    const usize count = values.size() < free ? values.size() : free;
+    for(usize i = 0; i < count; i++) {
+      kta::construct_at<T>(slot_(tail + i), values[i]);
+    }
+
+    if(count != 0) tail_.store(tail + count, MemoryOrder::Release);
+    return count;
+  }
+
+  /// Consumer side.
+  NODISCARD_ auto try_pop() -> Option<T> {
+    const usize head = head_.load(MemoryOrder::Relaxed);
+    if(head == cached_tail_) {
+      cached_tail_ = tail_.load(MemoryOrder::Acquire);
+      if(head == cached_tail_) return {};
+    }
+
+    T* slot = slot_(head);
+    Option<T> out(kta::move(*slot));
+    kta::destroy_at<T>(slot);
+    head_.store(head + 1, MemoryOrder::Release);
+    return out;
+  }
+
+  /// Moves up to out.size() elements into out, releasing all of their slots at once.
+  /// Returns the number of elements popped.
+  auto pop_batch(Span<T> out) -> usize {
+    const usize head = head_.load(MemoryOrder::Relaxed);
+    usize available = cached_tail_ - head;
+    if(available < out.size()) {
+      cached_tail_ = tail_.load(MemoryOrder::Acquire);
+      available = cached_tail_ - head;
+    }
+
+    const usize count = out.size() < available ? out.size() : available;
+    for(usize i = 0; i < count; i++) {
+      T* slot = slot_(head + i);
+      out[i] = kta::move(*slot);
+      kta::destroy_at<T>(slot);
+    }
+
+    if(count != 0) head_.store(head + count, MemoryOrder::Release);
+    return count;
+  }
+
+  /// Only a snapshot when called while the other side is active.
+  NODISCARD_ auto size_approx() const -> usize {
+    const usize head = head_.load(MemoryOrder::Acquire);
+    const usize tail = tail_.load(MemoryOrder::Acquire);
+    return tail - head;
+  }
+
+  NODISCARD_ auto empty_approx() const -> bool { return size_approx() == 0; }
+  NODISCARD_ static constexpr auto capacity() -> usize { return cap_; }
+
+  SpscRing() = default;
+
+  /// Must not race with either side.
+  ~SpscRing() {
+    if constexpr(!IsTriviallyDestructible<T>) {
+      const usize tail = tail_.load(MemoryOrder::Relaxed);
+      for(usize i = head_.load(MemoryOrder::Relaxed); i != tail; i++) {
+        kta::destroy_at<T>(slot_(i));
+      }
+    }
+  }
+private:
+  NODISCARD_ FORCEINLINE_ auto slot_(usize index) -> T* {
+    return reinterpret_cast<T*>(&storage_[(index & (cap_ - 1)) * sizeof(T)]);
+  }
+
+  /// Written by the consumer.
+  alignas(cache_line_size) Atomic<usize> head_;
+  usize cached_tail_ = 0;
+
+  /// Written by the producer.
+  alignas(cache_line_size) Atomic<usize> tail_;
+  usize cached_head_ = 0;
+
+  alignas(cache_line_size) alignas(T) uint8 storage_[cap_ * sizeof(T)];
+};
+
+END_NAMESPACE_KTA_
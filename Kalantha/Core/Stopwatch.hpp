@@ -0,0 +1,183 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Core/Locks.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/TSC.hpp>
+#  endif
+
+#  ifdef KTA_ASSUME_TESTING_ENV_
+#  if defined(KTA_BUILD_PLATFORM_POSIX)
+#include <time.h>
+#define KTA_HAS_MONOTONIC_CLOCK_
+#  endif //defined(KTA_BUILD_PLATFORM_POSIX)
+#  endif //KTA_ASSUME_TESTING_ENV_
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Cheap timestamps for timing hot code.
+*
+* read_cycle_counter() is the cheapest counter the CPU has that ticks
+* at a fixed rate: the TSC on x86-64, CNTVCT_EL0 on ARM64. elsewhere
+* it falls back to the monotonic clock, where there is one. so does
+* x86-64 when the TSC isn't invariant, since its rate then follows
+* the core clock.
+*
+* the rate is worked out once, on first use: from cpuid where the CPU
+* reports it, otherwise by timing the counter against the monotonic
+* clock. freestanding builds that have no such clock should tell us
+* with set_cycle_counter_frequency(); until then cycles convert to 0 ns.
+*/
+
+BEGIN_NAMESPACE(detail_);
+
+#  if defined(KTA_HAS_MONOTONIC_CLOCK_)
+inline auto monotonic_ns_() -> uint64 {
+  timespec ts{};
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64>(ts.tv_sec) * 1'000'000'000 + static_cast<uint64>(ts.tv_nsec);
+}
+#  endif //defined(KTA_HAS_MONOTONIC_CLOCK_)
+
+#  if defined(ARCH_X86_64) && defined(KTA_HAS_MONOTONIC_CLOCK_)
+inline constinit OnceFlag tsc_checked_once_{};
+inline constinit bool tsc_invariant_ = false;
+
+/// Whether read_cycle_counter() reads the TSC rather than the monotonic clock.
+NODISCARD_ FORCEINLINE_ auto use_tsc_() -> bool {
+  tsc_checked_once_.call([] { tsc_invariant_ = x86_64::has_invariant_tsc(); });
+  return tsc_invariant_;
+}
+#  endif
+
+NODISCARD_ inline auto detect_cycle_counter_frequency_() -> uint64 {
+#  if defined(ARCH_X86_64)
+#    if defined(KTA_HAS_MONOTONIC_CLOCK_)
+  if(!use_tsc_()) return 1'000'000'000;
+#    endif
+  const uint64 hz = x86_64::tsc_frequency_from_cpuid();
+  if(hz != 0) return hz;
+#    if defined(KTA_HAS_MONOTONIC_CLOCK_)
+  return x86_64::calibrate_tsc_frequency(&monotonic_ns_);
+#    else
+  return 0;
+#    endif
+#  elif defined(ARCH_ARM64)
+  uint64 hz;
+  asm volatile("mrs %0, cntfrq_el0" : "=r"(hz));
+  return hz;
+#  elif defined(KTA_HAS_MONOTONIC_CLOCK_)
+  return 1'000'000'000;
+#  else
+  return 0;
+#  endif
+}
+
+/// Counter frequency, and nanoseconds per tick in 32.32 fixed point.
+struct CycleClock_ {
+  Atomic<uint64> frequency{0};
+  Atomic<uint64> ns_per_tick_q32{0};
+};
+
+/// Detection can take a calibration run, so only one thread does it.
+inline constinit CycleClock_ cycle_clock_{};
+inline constinit OnceFlag cycle_clock_once_{};
+
+inline auto store_cycle_clock_(uint64 hz) -> void {
+  const uint64 q32 = hz != 0 ? static_cast<uint64>((static_cast<unsigned __int128>(1'000'000'000) << 32) / hz) : 0;
+  cycle_clock_.frequency.store(hz, MemoryOrder::Relaxed);
+  cycle_clock_.ns_per_tick_q32.store(q32, MemoryOrder::Relaxed);
+}
+
+NODISCARD_ FORCEINLINE_ auto load_cycle_clock_() -> const CycleClock_& {
+  cycle_clock_once_.call([] { store_cycle_clock_(detect_cycle_counter_frequency_()); });
+  return cycle_clock_;
+}
+
+END_NAMESPACE(detail_);
+
+NODISCARD_ FORCEINLINE_ auto read_cycle_counter() -> uint64 {
+#  if defined(ARCH_X86_64)
+#    if defined(KTA_HAS_MONOTONIC_CLOCK_)
+  if(!detail_::use_tsc_()) [[unlikely]] return detail_::monotonic_ns_();
+#    endif
+  return x86_64::rdtsc();
+#  elif defined(ARCH_ARM64)
+  uint64 ticks;
+  asm volatile("isb; mrs %0, cntvct_el0" : "=r"(ticks) :: "memory");
+  return ticks;
+#  elif defined(KTA_HAS_MONOTONIC_CLOCK_)
+  return detail_::monotonic_ns_();
+#  else
+  return 0;
+#  endif
+}
+
+/// Ticks per second of read_cycle_counter(), 0 if unknown.
+NODISCARD_ inline auto cycle_counter_frequency() -> uint64 {
+  return detail_::load_cycle_clock_().frequency.load(MemoryOrder::Relaxed);
+}
+
+/// Overrides the detected frequency, for embedders that know it better.
+/// Called before first use, detection never runs. Conversions racing
+/// with this may still use the old frequency.
+inline auto set_cycle_counter_frequency(uint64 hz) -> void {
+  bool stored = false;
+  detail_::cycle_clock_once_.call([&] {
+    detail_::store_cycle_clock_(hz);
+    stored = true;
+  });
+  if(!stored) detail_::store_cycle_clock_(hz);
+}
+
+NODISCARD_ inline auto cycles_to_ns(uint64 cycles) -> uint64 {
+  const unsigned __int128 ns = static_cast<unsigned __int128>(cycles)
+    * detail_::load_cycle_clock_().ns_per_tick_q32.load(MemoryOrder::Relaxed);
+  return static_cast<uint64>(ns >> 32);
+}
+
+/// Measures time since it was started, in cycle counter ticks.
+/// Starts on construction.
+class Stopwatch {
+public:
+  auto restart() -> void {
+    start_ = read_cycle_counter();
+  }
+
+  NODISCARD_ auto elapsed_cycles() const -> uint64 {
+    return read_cycle_counter() - start_;
+  }
+
+  NODISCARD_ auto elapsed_ns() const -> uint64 {
+    return cycles_to_ns(elapsed_cycles());
+  }
+
+  /// Elapsed ticks, then restarts from now.
+  NODISCARD_ auto lap_cycles() -> uint64 {
+    const uint64 now = read_cycle_counter();
+    const uint64 elapsed = now - start_;
+    start_ = now;
+    return elapsed;
+  }
+
+  NODISCARD_ auto lap_ns() -> uint64 {
+    return cycles_to_ns(lap_cycles());
+  }
+
+  NODISCARD_ auto start_cycles() const -> uint64 { return start_; }
+
+  Stopwatch() : start_(read_cycle_counter()) {}
+private:
+  uint64 start_ = 0;
+};
+
+END_NAMESPACE_KTA_
@@ -12,10 +12,12 @@
 #include <Kalantha/Core/Assertions.hpp>
 #include <Kalantha/Meta/Concepts.hpp>
 #include <Kalantha/Core/Iterator.hpp>
+#include <Kalantha/Core/Niche.hpp>
 BEGIN_NAMESPACE_KTA_
 
 template<Character Char>
 class StringView_ {
+  template<typename> friend struct NicheTraits;
 public:
   using Iterator = KtaIterator<AddConst<Char>>;
   using CharType = AddConst<RemoveVolatile<Char>>;
@@ -97,6 +99,23 @@ private:
   AddConst<Char>* end_ = nullptr;
 };
 
+/// A view has either both pointers null or begins at a real address,
+/// so a null begin with a non-null end is never one.
+template<Character Char>
+struct NicheTraits<StringView_<Char>> {
+  static constexpr bool has_niche = true;
+
+  NODISCARD_ FORCEINLINE_ static auto niche() -> StringView_<Char> {
+    StringView_<Char> view;
+    view.end_ = NicheTraits<AddConst<Char>*>::niche();
+    return view;
+  }
+
+  NODISCARD_ FORCEINLINE_ static auto is_niche(const StringView_<Char>& value) -> bool {
+    return value.beg_ == nullptr && value.end_ != nullptr;
+  }
+};
+
 using StringView   = StringView_<char>;
 using U8StringView = StringView_<char8_t>;
 using WStringView  = StringView_<wchar_t>;
@@ -0,0 +1,127 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+
+#  ifdef KTA_ASSUME_TESTING_ENV_
+#  if defined(KTA_BUILD_PLATFORM_POSIX)
+#include <pthread.h>
+#include <unistd.h>
+#define KTA_HAS_PTHREADS_
+#  endif //defined(KTA_BUILD_PLATFORM_POSIX)
+
+#  if defined(KTA_BUILD_PLATFORM_LINUX)
+#include <sched.h>
+#define KTA_HAS_AFFINITY_
+#  endif //defined(KTA_BUILD_PLATFORM_LINUX)
+#  endif //KTA_ASSUME_TESTING_ENV_
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Kalantha doesn't know how to create threads by itself.
+* whoever needs threads (the task scheduler, for one) goes through
+* a ThreadPlatform: a handful of function pointers supplied by the
+* embedder. in the testing environment they default to pthreads.
+*/
+
+struct ThreadHandle {
+  uintptr native = 0;
+};
+
+struct ThreadPlatform {
+  using Entry = void(*)(void*);
+
+  /// Starts entry(arg) on a new thread. Returns false on failure.
+  bool  (*spawn)(ThreadHandle& out, Entry entry, void* arg) = nullptr;
+  void  (*join)(ThreadHandle handle) = nullptr;
+
+  /// Optional. Number of CPUs available to us, 0 if unknown.
+  usize (*hardware_concurrency)() = nullptr;
+
+  /// Optional. Pins the calling thread to a CPU. Returns false on failure.
+  bool  (*pin_current)(usize cpu) = nullptr;
+
+  NODISCARD_ auto is_available() const -> bool {
+    return spawn != nullptr && join != nullptr;
+  }
+
+  NODISCARD_ auto cpu_count() const -> usize {
+    return hardware_concurrency != nullptr ? hardware_concurrency() : 0;
+  }
+};
+
+#  if defined(KTA_HAS_PTHREADS_)
+BEGIN_NAMESPACE(detail_);
+
+static_assert(sizeof(pthread_t) <= sizeof(uintptr), "pthread_t doesn't fit in a ThreadHandle");
+
+struct PthreadStart_ {
+  ThreadPlatform::Entry entry;
+  void* arg;
+};
+
+inline auto pthread_spawn_(ThreadHandle& out, ThreadPlatform::Entry entry, void* arg) -> bool {
+  auto* start = new PthreadStart_{entry, arg};
+  pthread_t thread{};
+  const int res = ::pthread_create(&thread, nullptr, [](void* p) -> void* {
+    const PthreadStart_ unpacked = *static_cast<PthreadStart_*>(p);
+    delete static_cast<PthreadStart_*>(p);
+    unpacked.entry(unpacked.arg);
+    return nullptr;
+  }, start);
+
+  if(res != 0) {
+    delete start;
+    return false;
+  }
+
+  out.native = 0;
+  __builtin_memcpy(&out.native, &thread, sizeof(thread));
+  return true;
+}
+
+inline auto pthread_join_(ThreadHandle handle) -> void {
+  pthread_t thread{};
+  __builtin_memcpy(&thread, &handle.native, sizeof(thread));
+  ::pthread_join(thread, nullptr);
+}
+
+inline auto pthread_hardware_concurrency_() -> usize {
+  const long count = ::sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? static_cast<usize>(count) : 0;
+}
+
+inline auto pthread_pin_current_(UNUSED_ usize cpu) -> bool {
+#  if defined(KTA_HAS_AFFINITY_)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#  else
+  return false;
+#  endif
+}
+
+END_NAMESPACE(detail_);
+#  endif //defined(KTA_HAS_PTHREADS_)
+
+/// The platform used when none is given explicitly.
+/// Outside of the testing environment this has no threads to offer.
+NODISCARD_ inline auto default_thread_platform() -> ThreadPlatform {
+  ThreadPlatform platform;
+#  if defined(KTA_HAS_PTHREADS_)
+  platform.spawn                = &detail_::pthread_spawn_;
+  platform.join                 = &detail_::pthread_join_;
+  platform.hardware_concurrency = &detail_::pthread_hardware_concurrency_;
+  platform.pin_current          = &detail_::pthread_pin_current_;
+#  endif
+  return platform;
+}
+
+END_NAMESPACE_KTA_
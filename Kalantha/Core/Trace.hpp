@@ -0,0 +1,272 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/StringView.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Core/Locks.hpp>
+#include <Kalantha/Core/Stopwatch.hpp>
+#include <Kalantha/Core/OStream.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Scoped trace zones.
+*
+* KTA_TRACE_SCOPE("name") times the rest of the enclosing scope and
+* records it into the calling thread's TraceBuffer, as one event with
+* both timestamps. without KTA_TRACING_ON_ defined the macro expands
+* to nothing, so zones can stay in hot code.
+*
+* each thread records into its own buffer, attached with
+* trace_attach_thread(). the buffer has a single writer: recording
+* loads the write position, compares it with the end of the storage,
+* stores the event and release stores the new position. no locks or
+* read-modify-writes. a full buffer drops events and counts them.
+* threads without a buffer record nothing, and skip the timestamps.
+*
+* a zone costs its two read_cycle_counter() calls plus a few ns.
+*
+* write_chrome_trace() writes every attached buffer out as Chrome
+* trace-event JSON, which chrome://tracing and Perfetto can open.
+* names have to outlive the export; string literals are the intent.
+*
+* the current buffer is thread_local, so freestanding builds need
+* thread local storage set up before attaching one.
+*/
+
+class TraceBuffer;
+
+inline auto trace_attach_thread(TraceBuffer& buffer) -> void;
+inline auto trace_detach_buffer(TraceBuffer& buffer) -> void;
+
+template<usize N>
+auto write_chrome_trace(OStream<N>& out) -> usize;
+
+struct TraceEvent {
+  const char* name = nullptr;
+  uint64 begin = 0; /// Cycle counter ticks, see Stopwatch.hpp.
+  uint64 end   = 0;
+};
+
+class TraceBuffer {
+  KTA_MAKE_NONCOPYABLE(TraceBuffer);
+  KTA_MAKE_NONMOVABLE(TraceBuffer);
+  friend auto trace_attach_thread(TraceBuffer& buffer) -> void;
+  friend auto trace_detach_buffer(TraceBuffer& buffer) -> void;
+  template<usize N>
+  friend auto write_chrome_trace(OStream<N>& out) -> usize;
+public:
+  /// Only ever called by the owning thread.
+  FORCEINLINE_ auto record(const char* name, uint64 begin, uint64 end) -> void {
+    TraceEvent* const slot = tail_.load(MemoryOrder::Relaxed);
+    if(slot == limit_) [[unlikely]] {
+      dropped_.store(dropped_.load(MemoryOrder::Relaxed) + 1, MemoryOrder::Relaxed);
+      return;
+    }
+
+    *slot = TraceEvent{name, begin, end};
+    tail_.store(slot + 1, MemoryOrder::Release);
+  }
+
+  /// Events recorded so far. Safe to call from other threads while the owner records.
+  NODISCARD_ auto events() const -> Span<const TraceEvent> {
+    return Span<const TraceEvent>(events_, static_cast<usize>(tail_.load(MemoryOrder::Acquire) - events_));
+  }
+
+  /// Only while nothing records into this buffer or exports it.
+  auto clear() -> void {
+    tail_.store(events_, MemoryOrder::Relaxed);
+    dropped_.store(0, MemoryOrder::Relaxed);
+  }
+
+  NODISCARD_ auto dropped()   const -> usize { return dropped_.load(MemoryOrder::Relaxed); }
+  NODISCARD_ auto capacity()  const -> usize { return static_cast<usize>(limit_ - events_); }
+  NODISCARD_ auto thread_id() const -> uint32 { return thread_id_; }
+  NODISCARD_ auto name()      const -> const char* { return name_; }
+
+  /// storage has to outlive the buffer. name shows up as the thread's name in the viewer.
+  explicit TraceBuffer(Span<TraceEvent> storage, const char* name = nullptr)
+    : events_(storage.data()), limit_(storage.data() + storage.size()), tail_(storage.data()), name_(name) {}
+
+  /// Leaves the export if it's still in it, so the registry never points
+  /// at a dead buffer. Its thread must not record into it anymore.
+  ~TraceBuffer() {
+    if(attached_) trace_detach_buffer(*this);
+  }
+private:
+  TraceEvent* events_ = nullptr;
+  TraceEvent* limit_  = nullptr; /// One past the storage.
+  Atomic<TraceEvent*> tail_{nullptr}; /// Where the next event goes.
+  Atomic<usize> dropped_{0};
+  const char* name_ = nullptr;
+  uint32 thread_id_ = 0;
+  TraceBuffer* next_ = nullptr;
+  bool attached_ = false;
+};
+
+BEGIN_NAMESPACE(detail_);
+
+inline thread_local constinit TraceBuffer* trace_current_ = nullptr;
+
+/// Every buffer ever attached, until detached. Only touched when
+/// attaching, detaching and exporting, never while recording.
+inline constinit SpinLock trace_registry_lock_{};
+inline constinit TraceBuffer* trace_registry_ = nullptr;
+inline constinit uint32 trace_next_thread_id_ = 1;
+
+template<usize N>
+auto write_trace_string_(OStream<N>& out, const char* str) -> void {
+  constexpr char hex[] = "0123456789abcdef";
+  out << '"';
+  for(; *str != '\0'; ++str) {
+    const char ch = *str;
+    if(ch == '"' || ch == '\\') {
+      out << '\\' << ch;
+    } else if(static_cast<uint8>(ch) < 0x20) {
+      out << StringView("\\u00") << hex[static_cast<uint8>(ch) >> 4] << hex[ch & 0xF];
+    } else {
+      out << ch;
+    }
+  }
+  out << '"';
+}
+
+/// Nanoseconds, written as microseconds with three decimals.
+template<usize N>
+auto write_trace_us_(OStream<N>& out, uint64 ns) -> void {
+  const uint64 frac = ns % 1000;
+  out << (ns / 1000) << '.'
+      << static_cast<char>('0' + frac / 100)
+      << static_cast<char>('0' + frac / 10 % 10)
+      << static_cast<char>('0' + frac % 10);
+}
+
+END_NAMESPACE(detail_);
+
+/// Makes buffer the calling thread's trace buffer, and registers it for export.
+inline auto trace_attach_thread(TraceBuffer& buffer) -> void {
+  LockGuard guard(detail_::trace_registry_lock_);
+  if(!buffer.attached_) {
+    buffer.thread_id_ = detail_::trace_next_thread_id_++;
+    buffer.next_      = detail_::trace_registry_;
+    buffer.attached_  = true;
+    detail_::trace_registry_ = &buffer;
+  }
+
+  detail_::trace_current_ = &buffer;
+}
+
+/// Stops recording on the calling thread. Its buffer stays registered.
+inline auto trace_detach_thread() -> void {
+  detail_::trace_current_ = nullptr;
+}
+
+/// Takes buffer out of the export. Its thread must not record into it anymore.
+inline auto trace_detach_buffer(TraceBuffer& buffer) -> void {
+  LockGuard guard(detail_::trace_registry_lock_);
+  if(detail_::trace_current_ == &buffer) detail_::trace_current_ = nullptr;
+
+  for(TraceBuffer** link = &detail_::trace_registry_; *link != nullptr; link = &(*link)->next_) {
+    if(*link == &buffer) {
+      *link = buffer.next_;
+      break;
+    }
+  }
+
+  buffer.next_     = nullptr;
+  buffer.attached_ = false;
+}
+
+NODISCARD_ inline auto trace_thread_buffer() -> TraceBuffer* {
+  return detail_::trace_current_;
+}
+
+/**
+ * @brief Write every registered buffer as Chrome trace-event JSON. Timestamps
+ * are relative to the earliest event. Can run while other threads record;
+ * events recorded after a buffer has been read are left out.
+ * @return The number of events written.
+ */
+template<usize N>
+auto write_chrome_trace(OStream<N>& out) -> usize {
+  LockGuard guard(detail_::trace_registry_lock_);
+
+  uint64 origin  = ~0ull;
+  usize  dropped = 0;
+  for(TraceBuffer* buffer = detail_::trace_registry_; buffer != nullptr; buffer = buffer->next_) {
+    for(const TraceEvent& event : buffer->events()) {
+      if(event.begin < origin) origin = event.begin;
+    }
+    dropped += buffer->dropped();
+  }
+
+  usize written = 0;
+  bool  first   = true;
+  out << kta::dec << StringView("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  for(TraceBuffer* buffer = detail_::trace_registry_; buffer != nullptr; buffer = buffer->next_) {
+    if(buffer->name_ != nullptr) {
+      out << StringView(first ? "\n" : ",\n")
+          << StringView("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":") << buffer->thread_id_
+          << StringView(",\"args\":{\"name\":");
+      detail_::write_trace_string_(out, buffer->name_);
+      out << StringView("}}");
+      first = false;
+    }
+
+    /// Zones recorded since the first pass can start before origin.
+    for(const TraceEvent& event : buffer->events()) {
+      const uint64 begin = event.begin > origin ? event.begin - origin : 0;
+      out << StringView(first ? "\n" : ",\n") << StringView("{\"name\":");
+      detail_::write_trace_string_(out, event.name);
+      out << StringView(",\"ph\":\"X\",\"ts\":");
+      detail_::write_trace_us_(out, cycles_to_ns(begin));
+      out << StringView(",\"dur\":");
+      detail_::write_trace_us_(out, cycles_to_ns(event.end - event.begin));
+      out << StringView(",\"pid\":1,\"tid\":") << buffer->thread_id_ << '}';
+      first = false;
+      written++;
+    }
+  }
+
+  out << StringView("\n],\"otherData\":{\"dropped_events\":") << dropped << StringView("}}\n");
+  out.flush();
+  return written;
+}
+
+/// Records the time from construction to destruction. Use KTA_TRACE_SCOPE.
+class TraceScope {
+  KTA_MAKE_NONCOPYABLE(TraceScope);
+  KTA_MAKE_NONMOVABLE(TraceScope);
+public:
+  FORCEINLINE_ explicit TraceScope(const char* name)
+    : buffer_(detail_::trace_current_), name_(name) {
+    if(buffer_ != nullptr) begin_ = read_cycle_counter();
+  }
+
+  FORCEINLINE_ ~TraceScope() {
+    if(buffer_ != nullptr) buffer_->record(name_, begin_, read_cycle_counter());
+  }
+private:
+  TraceBuffer* buffer_;
+  const char* name_;
+  uint64 begin_ = 0;
+};
+
+END_NAMESPACE_KTA_
+
+#define KTA_TRACE_CONCAT_IMPL_(A, B) A##B
+#define KTA_TRACE_CONCAT_(A, B) KTA_TRACE_CONCAT_IMPL_(A, B)
+
+#  if defined(KTA_TRACING_ON_)
+#define KTA_TRACE_SCOPE(NAME) ::kta::TraceScope KTA_TRACE_CONCAT_(kta_trace_scope_, __LINE__){NAME}
+#  else
+#define KTA_TRACE_SCOPE(NAME) static_cast<void>(0)
+#  endif //defined(KTA_TRACING_ON_)
@@ -9,6 +9,7 @@
 #include <Kalantha/Core/Platform.hpp>
 #include <Kalantha/Core/Types.hpp>
 #include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Niche.hpp>
 #include <Kalantha/Meta/TypeTraits.hpp>
 BEGIN_NAMESPACE_KTA_
 
@@ -33,16 +34,39 @@ NODISCARD_ constexpr auto move(T&& obj) -> RemoveReference<T>&& {
   return static_cast<RemoveReference<T>&&>(obj);
 }
 
+template<typename T>
+constexpr auto swap(T& a, T& b) -> void {
+  T tmp = kta::move(a);
+  a = kta::move(b);
+  b = kta::move(tmp);
+}
+
 template <typename T>
 class ReferenceWrapper {
   KTA_MAKE_DEFAULT_CONSTRUCTIBLE(ReferenceWrapper);
   KTA_MAKE_DEFAULT_ASSIGNABLE(ReferenceWrapper);
+  template<typename> friend struct NicheTraits;
 public:
   const T& get() const { return *ptr_; }
   T& get() { return *ptr_; }
   ReferenceWrapper(T& r) : ptr_(&r) {}
 private:
+  ReferenceWrapper() = default; /// Refers to nothing: the niche.
   T* ptr_ = nullptr;
 };
 
+/// A wrapper always refers to something, which makes Option<T&> pointer sized.
+template<typename T>
+struct NicheTraits<ReferenceWrapper<T>> {
+  static constexpr bool has_niche = true;
+
+  NODISCARD_ FORCEINLINE_ static auto niche() -> ReferenceWrapper<T> {
+    return ReferenceWrapper<T>{};
+  }
+
+  NODISCARD_ FORCEINLINE_ static auto is_niche(const ReferenceWrapper<T>& value) -> bool {
+    return value.ptr_ == nullptr;
+  }
+};
+
 END_NAMESPACE_KTA_
@@ -0,0 +1,312 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Span.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Meta/TypeTraits.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+
+#  if defined(ARCH_X86_64)
+#include <Kalantha/Arch/x86_64/SIMD.hpp>
+#  endif
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Compact integer encodings.
+*
+* LEB128 varints store 7 bits per byte, low bits first, with the top
+* bit of every byte but the last set. small values take one byte, a
+* full uint64 takes ten. zigzag maps signed values to unsigned ones
+* so that small negative numbers stay small too.
+*
+* Stream VByte stores the byte lengths of four uint32s in one control
+* byte, ahead of all of the data bytes. a decoder can then expand four
+* values at a time with a single byte shuffle, no branches per value.
+*/
+
+template<typename T>
+concept VarintType = IsSame<T, uint32> || IsSame<T, uint64>;
+
+template<VarintType T>
+inline constexpr usize max_varint_size = (sizeof(T) * 8 + 6) / 7;
+
+NODISCARD_ constexpr auto zigzag_encode(int32 value) -> uint32 {
+  return (static_cast<uint32>(value) << 1) ^ static_cast<uint32>(value >> 31);
+}
+
+NODISCARD_ constexpr auto zigzag_encode(int64 value) -> uint64 {
+  return (static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63);
+}
+
+NODISCARD_ constexpr auto zigzag_decode(uint32 value) -> int32 {
+  return static_cast<int32>((value >> 1) ^ (0u - (value & 1u)));
+}
+
+NODISCARD_ constexpr auto zigzag_decode(uint64 value) -> int64 {
+  return static_cast<int64>((value >> 1) ^ (0ull - (value & 1ull)));
+}
+
+/// Number of bytes the LEB128 encoding of value takes.
+NODISCARD_ constexpr auto varint_size(uint64 value) -> usize {
+  const usize bits = 64 - static_cast<usize>(__builtin_clzll(value | 1));
+  return (bits + 6) / 7;
+}
+
+BEGIN_NAMESPACE(detail_);
+
+template<VarintType T>
+FORCEINLINE_ auto put_varint_(T value, uint8* out) -> usize {
+  usize i = 0;
+  while(value >= 0x80) {
+    out[i++] = static_cast<uint8>(value) | 0x80;
+    value >>= 7;
+  }
+
+  out[i++] = static_cast<uint8>(value);
+  return i;
+}
+
+/// Returns the length of the varint at p, 0 if it is cut
+/// short by the end of the input or doesn't fit in a T.
+template<VarintType T>
+FORCEINLINE_ auto get_varint_(const uint8* p, usize avail, T& out) -> usize {
+  constexpr usize max = max_varint_size<T>;
+  const usize limit = avail < max ? avail : max;
+
+  T value = 0;
+  for(usize i = 0; i < limit; i++) {
+    const uint8 byte = p[i];
+    value |= static_cast<T>(byte & 0x7F) << (7 * i);
+    if(!(byte & 0x80)) {
+      if(i == max - 1 && (byte >> (sizeof(T) * 8 - 7 * i)) != 0) return 0;
+      out = value;
+      return i + 1;
+    }
+  }
+
+  return 0;
+}
+
+/// Works out why get_varint_ failed. Only called on the error path.
+template<VarintType T>
+NODISCARD_ auto varint_error_(const uint8* p, usize avail) -> Error {
+  constexpr usize max = max_varint_size<T>;
+  for(usize i = 0; i < avail && i < max; i++) {
+    if(!(p[i] & 0x80)) return Error{"Varint: value doesn't fit the integer type!", ErrC::InvalidArg};
+  }
+
+  if(avail < max) return Error{"Varint: input ends in the middle of a value!", ErrC::Underflow};
+  return Error{"Varint: value is too long!", ErrC::InvalidArg};
+}
+
+/// Returns the control code (byte length - 1) of a Stream VByte value.
+NODISCARD_ FORCEINLINE_ auto svb_code_(uint32 value) -> uint32 {
+  return (value > 0xFF) + (value > 0xFFFF) + (value > 0xFFFFFF);
+}
+
+struct SvbTables_ {
+  uint8 shuffle[256][16]{};
+  uint8 length[256]{};
+};
+
+/// For each control byte: which data byte goes to each output byte
+/// (0x80 zeroes it), and how many data bytes the four values take.
+NODISCARD_ consteval auto make_svb_tables_() -> SvbTables_ {
+  SvbTables_ tables;
+  for(usize ctrl = 0; ctrl < 256; ctrl++) {
+    usize offset = 0;
+    for(usize v = 0; v < 4; v++) {
+      const usize len = ((ctrl >> (2 * v)) & 3) + 1;
+      for(usize b = 0; b < 4; b++) {
+        tables.shuffle[ctrl][v * 4 + b] = b < len ? static_cast<uint8>(offset + b) : 0x80;
+      }
+      offset += len;
+    }
+    tables.length[ctrl] = static_cast<uint8>(offset);
+  }
+  return tables;
+}
+
+inline constexpr SvbTables_ svb_tables_ = make_svb_tables_();
+
+/// Decodes values [first, n). Returns the end of the data bytes used,
+/// or nullptr if they run past end.
+inline auto svb_decode_scalar_(const uint8* ctrl, const uint8* data, const uint8* end,
+                               uint32* out, usize first, usize n) -> const uint8* {
+  for(usize i = first; i < n; i++) {
+    const usize len = ((ctrl[i / 4] >> (2 * (i % 4))) & 3) + 1;
+    if(static_cast<usize>(end - data) < len) return nullptr;
+
+    uint32 value = 0;
+    for(usize b = 0; b < len; b++) value |= static_cast<uint32>(data[b]) << (8 * b);
+    out[i] = value;
+    data += len;
+  }
+
+  return data;
+}
+
+#  if defined(ARCH_X86_64)
+/// Four values per control byte, as long as a full 16 byte load stays in bounds.
+KTA_TARGET_SSSE3_ inline auto svb_decode_ssse3_(const uint8* ctrl, const uint8* data, const uint8* end,
+                                                uint32* out, usize first, usize n) -> const uint8* {
+  usize i = first;
+  for(; i + 4 <= n && end - data >= 16; i += 4) {
+    const uint8 code = ctrl[i / 4];
+    const x86_64::Vec16i8 shuffle = x86_64::load_128(svb_tables_.shuffle[code]);
+    x86_64::store_128(out + i, __builtin_ia32_pshufb128(x86_64::load_128(data), shuffle));
+    data += svb_tables_.length[code];
+  }
+
+  return svb_decode_scalar_(ctrl, data, end, out, i, n);
+}
+#  endif //defined(ARCH_X86_64)
+
+/// SSSE3 is part of the SSE4.2 tier.
+inline constinit Dispatch<const uint8*(const uint8*, const uint8*, const uint8*, uint32*, usize, usize)> svb_decode_impl_{
+  &svb_decode_scalar_,
+#  if defined(ARCH_X86_64)
+  &svb_decode_ssse3_,
+#  endif
+};
+
+END_NAMESPACE(detail_);
+
+/**
+ * @brief Write the LEB128 encoding of a value.
+ * @return The number of bytes written, or ErrC::Overflow if out is too small.
+ */
+template<VarintType T>
+NODISCARD_ auto encode_varint(T value, Span<uint8> out) -> Result<usize, Error> {
+  if(out.size() < max_varint_size<T> && out.size() < varint_size(value)) {
+    return Error{"Varint: output is too small!", ErrC::Overflow};
+  }
+
+  return detail_::put_varint_(value, out.data());
+}
+
+/**
+ * @brief Read one LEB128 value from the front of in.
+ * @return The number of bytes read. ErrC::Underflow if in ends in the middle
+ * of the value, ErrC::InvalidArg if the value doesn't fit in a T.
+ */
+template<VarintType T>
+NODISCARD_ auto decode_varint(Span<const uint8> in, T& out) -> Result<usize, Error> {
+  const usize len = detail_::get_varint_(in.data(), in.size(), out);
+  if(len == 0) return detail_::varint_error_<T>(in.data(), in.size());
+  return len;
+}
+
+/**
+ * @brief Write the LEB128 encodings of all values back to back.
+ * @return The number of bytes written, or ErrC::Overflow if out is too small.
+ */
+template<typename S, VarintType T = RemoveCV<S>>
+NODISCARD_ auto encode_varints(Span<S> values, Span<uint8> out) -> Result<usize, Error> {
+  uint8* p = out.data();
+  uint8* const end = p + out.size();
+
+  for(const T value : values) {
+    const usize avail = static_cast<usize>(end - p);
+    if(avail < max_varint_size<T> && avail < varint_size(value)) {
+      return Error{"Varint: output is too small!", ErrC::Overflow};
+    }
+    p += detail_::put_varint_(value, p);
+  }
+
+  return static_cast<usize>(p - out.data());
+}
+
+/**
+ * @brief Read out.size() LEB128 values from the front of in.
+ * @return The number of bytes read, or an error as for decode_varint().
+ */
+template<VarintType T>
+NODISCARD_ auto decode_varints(Span<const uint8> in, Span<T> out) -> Result<usize, Error> {
+  const uint8* p = in.data();
+  const uint8* const end = p + in.size();
+  T* dst = out.data();
+  const usize n = out.size();
+
+  usize i = 0;
+  while(i < n) {
+    /// Runs of one byte values are common enough to take eight at a time.
+    if(n - i >= 8 && end - p >= 8) {
+      uint64 word;
+      __builtin_memcpy(&word, p, sizeof(word));
+      if((word & 0x8080808080808080ull) == 0) {
+        for(usize b = 0; b < 8; b++) dst[i + b] = p[b];
+        p += 8;
+        i += 8;
+        continue;
+      }
+    }
+
+    const usize avail = static_cast<usize>(end - p);
+    const usize len = detail_::get_varint_(p, avail, dst[i]);
+    if(len == 0) return detail_::varint_error_<T>(p, avail);
+    p += len;
+    i++;
+  }
+
+  return static_cast<usize>(p - in.data());
+}
+
+/// Upper bound on the Stream VByte encoding of count values.
+NODISCARD_ constexpr auto streamvbyte_max_size(usize count) -> usize {
+  return (count + 3) / 4 + count * sizeof(uint32);
+}
+
+/**
+ * @brief Encode values as Stream VByte: (size + 3) / 4 control bytes, then the data bytes.
+ * @return The number of bytes written, or ErrC::Overflow if out is too small.
+ */
+template<typename S> requires IsSame<RemoveCV<S>, uint32>
+NODISCARD_ auto streamvbyte_encode(Span<S> values, Span<uint8> out) -> Result<usize, Error> {
+  const usize n = values.size();
+  const usize ctrl_size = (n + 3) / 4;
+  if(out.size() < ctrl_size) return Error{"Stream VByte: output is too small!", ErrC::Overflow};
+
+  uint8* const ctrl = out.data();
+  uint8* data = ctrl + ctrl_size;
+  uint8* const end = out.data() + out.size();
+  if(ctrl_size != 0) __builtin_memset(ctrl, 0, ctrl_size);
+
+  for(usize i = 0; i < n; i++) {
+    const uint32 value = values[i];
+    const uint32 code = detail_::svb_code_(value);
+    if(static_cast<usize>(end - data) <= code) return Error{"Stream VByte: output is too small!", ErrC::Overflow};
+
+    ctrl[i / 4] |= static_cast<uint8>(code << (2 * (i % 4)));
+    for(uint32 b = 0; b <= code; b++) data[b] = static_cast<uint8>(value >> (8 * b));
+    data += code + 1;
+  }
+
+  return static_cast<usize>(data - out.data());
+}
+
+/**
+ * @brief Decode out.size() Stream VByte values from the front of in.
+ * @return The number of bytes read, or ErrC::Underflow if in is too short.
+ */
+inline auto streamvbyte_decode(Span<const uint8> in, Span<uint32> out) -> Result<usize, Error> {
+  const usize n = out.size();
+  const usize ctrl_size = (n + 3) / 4;
+  if(in.size() < ctrl_size) return Error{"Stream VByte: input is too short!", ErrC::Underflow};
+  if(n == 0) return usize(0);
+
+  const uint8* const end = in.data() + in.size();
+  const uint8* data_end = detail_::svb_decode_impl_(in.data(), in.data() + ctrl_size, end, out.data(), 0, n);
+  if(data_end == nullptr) return Error{"Stream VByte: input is too short!", ErrC::Underflow};
+  return static_cast<usize>(data_end - in.data());
+}
+
+END_NAMESPACE_KTA_
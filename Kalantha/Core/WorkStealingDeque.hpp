@@ -0,0 +1,146 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Common.hpp>
+#include <Kalantha/Core/Platform.hpp>
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Core/Memory.hpp>
+#include <Kalantha/Core/ClassTraits.hpp>
+#include <Kalantha/Core/Limits.hpp>
+#include <Kalantha/Core/Option.hpp>
+#include <Kalantha/Core/Result.hpp>
+#include <Kalantha/Core/Errors.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+#include <Kalantha/Allocators/AllocatorBase.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+BEGIN_NAMESPACE_KTA_
+
+/*
+* Chase-Lev work-stealing deque, with the memory orderings from
+* "Correct and Efficient Work-Stealing for Weak Memory Models"
+* (Lê, Pop, Cohen, Zappa Nardelli, 2013).
+*
+* the owning thread pushes and pops at the bottom, LIFO, without any
+* read-modify-write unless it is racing for the very last element.
+* any other thread may steal from the top, FIFO, with one CAS.
+*
+* the capacity is fixed. the original grows the buffer, but that needs
+* a way to reclaim the old one; callers here are expected to handle a
+* failed push (a scheduler simply runs the task inline).
+*
+* before init() the mask is -1, which makes the deque look permanently
+* full to push() and empty to pop() and steal(), so the missing buffer
+* is never touched.
+*/
+
+template<AtomicCapable T, typename Alloc = BumpAllocator>
+class WorkStealingDeque {
+  KTA_MAKE_NONCOPYABLE(WorkStealingDeque);
+  KTA_MAKE_NONMOVABLE(WorkStealingDeque);
+public:
+  using ValueType = T;
+
+  /// The capacity must be a power of two. Must be called once,
+  /// before the deque is shared.
+  auto init(usize capacity) -> Result<void, Error> {
+    if(buffer_ != nullptr)
+      return Error{"WorkStealingDeque: already initialized!", ErrC::InvalidArg};
+    if(capacity < 2 || (capacity & (capacity - 1)) != 0)
+      return Error{"WorkStealingDeque: capacity must be a power of two!", ErrC::InvalidArg};
+    if(alloc_ == nullptr || capacity > NumericLimits<usize>::max() / sizeof(Atomic<T>))
+      return Error{"WorkStealingDeque: allocation failure!", ErrC::NoMemory};
+
+    void* block = alloc_->allocate_bytes(alignof(Atomic<T>), capacity * sizeof(Atomic<T>));
+    if(block == nullptr) return Error{"WorkStealingDeque: allocation failure!", ErrC::NoMemory};
+
+    buffer_ = static_cast<Atomic<T>*>(block);
+    mask_   = static_cast<int64>(capacity - 1);
+    for(usize i = 0; i < capacity; i++) kta::construct_at<Atomic<T>>(buffer_ + i);
+    return Result<void, Error>::create();
+  }
+
+  /// Owner only. Returns false if the deque is full.
+  auto push(T value) -> bool {
+    const int64 b = bottom_.load(MemoryOrder::Relaxed);
+    const int64 t = top_.load(MemoryOrder::Acquire);
+    if(b - t > mask_) return false;
+
+    /// The paper has a release fence and a relaxed store here. A release
+    /// store is no more expensive, and race detectors can follow it.
+    buffer_[b & mask_].store(value, MemoryOrder::Relaxed);
+    bottom_.store(b + 1, MemoryOrder::Release);
+    return true;
+  }
+
+  /// Owner only. Takes the most recently pushed element.
+  NODISCARD_ auto pop() -> Option<T> {
+    const int64 b = bottom_.load(MemoryOrder::Relaxed) - 1;
+    bottom_.store(b, MemoryOrder::Relaxed);
+    atomic_thread_fence(MemoryOrder::SeqCst);
+    int64 t = top_.load(MemoryOrder::Relaxed);
+
+    if(t > b) {
+      bottom_.store(b + 1, MemoryOrder::Relaxed);
+      return {};
+    }
+
+    T value = buffer_[b & mask_].load(MemoryOrder::Relaxed);
+    if(t == b) {
+      /// Last element, thieves may be going for it too.
+      const bool won = top_.compare_exchange_strong(t, t + 1, MemoryOrder::SeqCst, MemoryOrder::Relaxed);
+      bottom_.store(b + 1, MemoryOrder::Relaxed);
+      if(!won) return {};
+    }
+
+    return value;
+  }
+
+  /// Any thread. Takes the oldest element. Fails if the deque is
+  /// empty or if another thread got there first.
+  NODISCARD_ auto steal() -> Option<T> {
+    int64 t = top_.load(MemoryOrder::Acquire);
+    atomic_thread_fence(MemoryOrder::SeqCst);
+    const int64 b = bottom_.load(MemoryOrder::Acquire);
+    if(t >= b) return {};
+
+    T value = buffer_[t & mask_].load(MemoryOrder::Relaxed);
+    if(!top_.compare_exchange_strong(t, t + 1, MemoryOrder::SeqCst, MemoryOrder::Relaxed))
+      return {};
+    return value;
+  }
+
+  NODISCARD_ auto size_approx() const -> usize {
+    const int64 b = bottom_.load(MemoryOrder::Relaxed);
+    const int64 t = top_.load(MemoryOrder::Relaxed);
+    return b > t ? static_cast<usize>(b - t) : 0;
+  }
+
+  NODISCARD_ auto empty_approx() const -> bool { return size_approx() == 0; }
+
+  NODISCARD_ auto capacity() const -> usize {
+    return buffer_ != nullptr ? static_cast<usize>(mask_) + 1 : 0;
+  }
+
+  explicit WorkStealingDeque(Alloc* alloc) : alloc_(alloc) {}
+  WorkStealingDeque() = default;
+
+  ~WorkStealingDeque() {
+    if(buffer_ == nullptr) return;
+    UNUSED_ auto res = alloc_->deallocate_bytes(buffer_, capacity() * sizeof(Atomic<T>));
+  }
+private:
+  /// Thieves.
+  alignas(cache_line_size) Atomic<int64> top_;
+
+  /// Owner.
+  alignas(cache_line_size) Atomic<int64> bottom_;
+  Atomic<T>* buffer_ = nullptr;
+  int64 mask_   = -1;
+  Alloc* alloc_ = nullptr;
+};
+
+END_NAMESPACE_KTA_
@@ -0,0 +1,30 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Allocators/AllocatorRef.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+using namespace kta;
+using kta_tests::ArenaFixture;
+
+TEST_CASE_METHOD(ArenaFixture, "AllocatorRef forwards to the allocator", "[Core.Memory.AllocatorRef]") {
+  AllocatorRef empty;
+  REQUIRE_FALSE(empty.is_valid());
+  REQUIRE(empty.allocate_bytes(8, 16) == nullptr);
+  REQUIRE(empty.remaining() == 0);
+
+  AllocatorRef ref(&arena);
+  REQUIRE(ref.is_valid());
+  const usize before = arena.remaining();
+  REQUIRE(ref.remaining() == before);
+
+  void* ptr = ref.allocate_bytes(16, 64);
+  REQUIRE(ptr != nullptr);
+  REQUIRE(reinterpret_cast<uintptr>(ptr) % 16 == 0);
+  REQUIRE(arena.remaining() < before);
+}
@@ -387,3 +387,26 @@ TEST_CASE_METHOD(BumpAllocatorFixture, "BumpAllocator - Alignment Requirements",
     REQUIRE(addr % 16 == 0);
   }
 }
+
+TEST_CASE_METHOD(BumpAllocatorFixture, "BumpAllocator - Freeing The Most Recent Block", "[Core.Memory.BumpAllocator]") {
+  BumpAllocator allocator(buffer_start, buffer_end);
+  void* first  = allocator.allocate_bytes(8, 64);
+  void* second = allocator.allocate_bytes(8, 64);
+  REQUIRE(first != nullptr);
+  REQUIRE(second != nullptr);
+
+  REQUIRE_FALSE(allocator.deallocate_bytes(first, 64).has_value());
+  REQUIRE(allocator.deallocate_bytes(second, 64).has_value());
+  REQUIRE(allocator.cur() == second);
+}
+
+TEST_CASE_METHOD(BumpAllocatorFixture, "BumpAllocator - Extending The Most Recent Block", "[Core.Memory.BumpAllocator]") {
+  BumpAllocator allocator(buffer_start, buffer_end);
+  void* first  = allocator.allocate_bytes(8, 64);
+  void* second = allocator.allocate_bytes(8, 64);
+
+  REQUIRE_FALSE(allocator.extend_bytes(first, 64, 128));
+  REQUIRE(allocator.extend_bytes(second, 64, 128));
+  REQUIRE(allocator.cur() == static_cast<uint8*>(second) + 128);
+  REQUIRE_FALSE(allocator.extend_bytes(second, 128, BUFFER_SIZE));
+}
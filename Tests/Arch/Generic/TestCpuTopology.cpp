@@ -0,0 +1,66 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Arch/Generic/CpuTopology.hpp>
+
+#include <iostream>
+
+using namespace kta;
+
+namespace {
+  auto print_cache(const char* name, const CacheInfo& cache) -> void {
+    std::cout << name << ": " << cache.size / 1024 << " KiB, "
+              << cache.line_size << " byte lines, "
+              << cache.ways << " ways, shared by " << cache.shared_by << "\n";
+  }
+
+  auto is_pow2(usize value) -> bool {
+    return value != 0 && (value & (value - 1)) == 0;
+  }
+}
+
+TEST_CASE("Default topology", "[Core.CpuTopology]") {
+  static_assert(default_cpu_topology.line_size() == 64);
+  static_assert(default_cpu_topology.l1d.size <= default_cpu_topology.l2.size);
+  static_assert(!default_cpu_topology.detected);
+
+  constexpr CpuTopology topology{};
+  REQUIRE(topology.threads_per_core == 1);
+  REQUIRE(topology.cores_per_package == 1);
+  REQUIRE(!topology.hybrid);
+}
+
+TEST_CASE("Detected topology", "[Core.CpuTopology]") {
+  const CpuTopology& topology = cpu_topology();
+  REQUIRE(&topology == &cpu_topology());
+
+  std::cout << "---- cpu topology (detected = " << topology.detected << "):\n";
+  print_cache("l1d", topology.l1d);
+  print_cache("l1i", topology.l1i);
+  print_cache("l2 ", topology.l2);
+  print_cache("l3 ", topology.l3);
+  std::cout << topology.threads_per_core << " threads per core, "
+            << topology.cores_per_package << " cores and "
+            << topology.logical_per_package << " logical processors per package\n";
+  std::cout << "core type: " << core_type_to_string(current_core_type()) << "\n";
+  std::cout.flush();
+
+  REQUIRE(topology.l1d.size != 0);
+  REQUIRE(is_pow2(topology.line_size()));
+  REQUIRE(topology.l2.size >= topology.l1d.size);
+  REQUIRE(topology.l1d.shared_by >= 1);
+  REQUIRE(topology.threads_per_core >= 1);
+  REQUIRE(topology.cores_per_package >= 1);
+  REQUIRE(topology.logical_per_package >= topology.threads_per_core);
+
+#  if defined(ARCH_X86_64)
+  REQUIRE(topology.detected);
+#  endif
+
+  if(!topology.hybrid) REQUIRE(current_core_type() == CoreType::Uniform);
+  else REQUIRE(current_core_type() != CoreType::Uniform);
+}
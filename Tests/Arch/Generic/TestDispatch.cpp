@@ -0,0 +1,124 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Arch/Generic/Dispatch.hpp>
+#include <Kalantha/Arch/Generic/Endian.hpp>
+#include <Kalantha/Core/CRC32C.hpp>
+#include <Kalantha/Core/Hash.hpp>
+#include <Kalantha/Core/Varint.hpp>
+#include <Kalantha/Core/Algorithm.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace kta;
+
+namespace {
+  auto variant_scalar(int x) -> int { return x * 10 + 0; }
+  auto variant_sse42(int x)  -> int { return x * 10 + 1; }
+  auto variant_avx2(int x)   -> int { return x * 10 + 2; }
+  auto variant_avx512(int x) -> int { return x * 10 + 3; }
+
+  constinit Dispatch<int(int)> all_variants{&variant_scalar, &variant_sse42, &variant_avx2, &variant_avx512};
+  constinit Dispatch<int(int)> some_variants{&variant_scalar, nullptr, &variant_avx2};
+  constinit Dispatch<int(int)> scalar_only{&variant_scalar};
+
+  constexpr SimdTier all_tiers[] = {SimdTier::Scalar, SimdTier::Sse42, SimdTier::Avx2, SimdTier::Avx512};
+
+  /// Puts the tier back to what the machine supports when a test ends.
+  struct TierGuard {
+    ~TierGuard() { set_simd_tier_limit(SimdTier::Avx512); }
+  };
+}
+
+TEST_CASE("SIMD tier detection", "[Core.Dispatch]") {
+  const SimdTier tier = simd_tier();
+  REQUIRE(tier <= detail_::hardware_simd_tier_());
+  REQUIRE(simd_tier() == tier);
+
+  REQUIRE(std::string(simd_tier_to_string(SimdTier::Scalar)) == "scalar");
+  REQUIRE(std::string(simd_tier_to_string(SimdTier::Avx512)) == "avx512");
+
+#  if defined(ARCH_X86_64)
+  /// Every tier implies what the kernels dispatched at it rely on.
+  const auto& features = x86_64::cpu_features();
+  if(tier >= SimdTier::Sse42) REQUIRE((features.has_ssse3() && features.has_sse4_2()));
+  if(tier >= SimdTier::Avx2) REQUIRE((features.has_avx2() && features.has_pclmul()));
+  if(tier >= SimdTier::Avx512) REQUIRE((features.has_avx512f() && features.has_avx512bw()));
+#  else
+  REQUIRE(tier == SimdTier::Scalar);
+#  endif
+}
+
+TEST_CASE("Dispatch picks the best variant at or below the tier", "[Core.Dispatch]") {
+  REQUIRE(all_variants.variant_for(SimdTier::Scalar) == &variant_scalar);
+  REQUIRE(all_variants.variant_for(SimdTier::Avx512) == &variant_avx512);
+  REQUIRE(some_variants.variant_for(SimdTier::Sse42) == &variant_scalar);
+  REQUIRE(some_variants.variant_for(SimdTier::Avx512) == &variant_avx2);
+  REQUIRE(scalar_only.variant_for(SimdTier::Avx2) == &variant_scalar);
+
+  TierGuard guard;
+
+  /// KTA_SIMD_TIER and -DKTA_SIMD_TIER_LIMIT_ cap the tier as well.
+  SimdTier ceiling = detail_::hardware_simd_tier_();
+  if(detail_::build_simd_tier_limit_() < ceiling) ceiling = detail_::build_simd_tier_limit_();
+  if(detail_::env_simd_tier_limit_() < ceiling) ceiling = detail_::env_simd_tier_limit_();
+
+  for(SimdTier limit : all_tiers) {
+    set_simd_tier_limit(limit);
+    const SimdTier tier = simd_tier();
+    REQUIRE(tier == (limit < ceiling ? limit : ceiling));
+
+    REQUIRE(all_variants(4) == 40 + static_cast<int>(tier));
+    REQUIRE(all_variants.get() == all_variants.variant_for(tier));
+    REQUIRE(some_variants(5) == (tier >= SimdTier::Avx2 ? 52 : 50));
+    REQUIRE(scalar_only(6) == 60);
+  }
+}
+
+TEST_CASE("Dispatched kernels agree at every tier", "[Core.Dispatch]") {
+  std::vector<uint32> values(1003);
+  uint32 state = 12345;
+  for(auto& value : values) {
+    state = state * 1664525u + 1013904223u;
+    value = state >> (state % 32);
+  }
+
+  const auto* bytes = reinterpret_cast<const uint8*>(values.data());
+  const usize byte_count = values.size() * sizeof(uint32);
+
+  std::vector<uint8> encoded(streamvbyte_max_size(values.size()));
+  const usize encoded_size = streamvbyte_encode(Span<const uint32>(values.data(), values.size()),
+                                                Span<uint8>(encoded.data(), encoded.size())).value();
+
+  TierGuard guard;
+  set_simd_tier_limit(SimdTier::Scalar);
+  const uint32 crc = crc32c(bytes, byte_count);
+  const uint64 hash = hash_bytes(bytes, byte_count);
+  const uint64 total = sum(Span<const uint32>(values.data(), values.size()));
+
+  std::vector<uint64> swapped(values.size() / 2);
+  byteswap(Span<const uint64>(reinterpret_cast<const uint64*>(values.data()), swapped.size()),
+           Span<uint64>(swapped.data(), swapped.size()));
+
+  for(SimdTier limit : all_tiers) {
+    set_simd_tier_limit(limit);
+    REQUIRE(crc32c(bytes, byte_count) == crc);
+    REQUIRE(hash_bytes(bytes, byte_count) == hash);
+    REQUIRE(sum(Span<const uint32>(values.data(), values.size())) == total);
+
+    std::vector<uint64> out(swapped.size());
+    byteswap(Span<const uint64>(reinterpret_cast<const uint64*>(values.data()), out.size()),
+             Span<uint64>(out.data(), out.size()));
+    REQUIRE(out == swapped);
+
+    std::vector<uint32> decoded(values.size());
+    REQUIRE(streamvbyte_decode(Span<const uint8>(encoded.data(), encoded_size),
+                               Span<uint32>(decoded.data(), decoded.size())).value() == encoded_size);
+    REQUIRE(decoded == values);
+  }
+}
@@ -10,6 +10,8 @@
 
 #include <cstring>
 #include <array>
+#include <vector>
+#include <algorithm>
 
 using namespace kta;
 
@@ -215,3 +217,136 @@ TEST_CASE("Constexpr evaluation", "[Core.Endian]") {
     REQUIRE_FALSE(false);
   }
 }
+
+TEST_CASE("Unaligned loads and stores", "[Core.Endian]") {
+  const uint8 bytes[] = {0xAA, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+
+  SECTION("Little-endian loads") {
+    REQUIRE(load_little<uint16>(bytes + 1) == 0x0201);
+    REQUIRE(load_little<uint32>(bytes + 1) == 0x04030201U);
+    REQUIRE(load_little<uint64>(bytes + 1) == 0x0807060504030201ULL);
+  }
+
+  SECTION("Big-endian loads") {
+    REQUIRE(load_big<uint16>(bytes + 1) == 0x0102);
+    REQUIRE(load_big<uint32>(bytes + 1) == 0x01020304U);
+    REQUIRE(load_big<uint64>(bytes + 1) == 0x0102030405060708ULL);
+  }
+
+  SECTION("Stores roundtrip at odd offsets") {
+    uint8 buff[11]{};
+    store_little<uint64>(buff + 1, 0x1122334455667788ULL);
+    REQUIRE(buff[1] == 0x88);
+    REQUIRE(load_little<uint64>(buff + 1) == 0x1122334455667788ULL);
+
+    store_big<uint16>(buff + 9, 0xBEEF);
+    REQUIRE(buff[9] == 0xBE);
+    REQUIRE(buff[10] == 0xEF);
+    REQUIRE(load_big<uint16>(buff + 9) == 0xBEEF);
+  }
+}
+
+namespace {
+  template<typename T>
+  auto make_values(usize count) -> std::vector<T> {
+    std::vector<T> values(count);
+    uint64 state = 0x9E3779B97F4A7C15ULL;
+    for(auto& value : values) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      value = static_cast<T>(state >> 7);
+    }
+    return values;
+  }
+
+  template<typename T>
+  auto swapped_one_by_one(const std::vector<T>& values) -> std::vector<T> {
+    std::vector<T> out(values.size());
+    for(usize i = 0; i < values.size(); i++) out[i] = byteswap(values[i]);
+    return out;
+  }
+}
+
+TEMPLATE_TEST_CASE("Byte swapping spans", "[Core.Endian]",
+  uint8, uint16, uint32, uint64, int16, int32, int64) {
+  /// Lengths around the 16, 32 and 64 byte steps of the vector kernels.
+  for(usize count : {0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 63, 64, 65, 100, 257, 1000}) {
+    const auto values = make_values<TestType>(count);
+    const auto expected = swapped_one_by_one(values);
+
+    auto in_place = values;
+    byteswap(Span<TestType>(in_place.data(), in_place.size()));
+    REQUIRE(in_place == expected);
+
+    std::vector<TestType> out(count + 1, TestType(0x5A));
+    byteswap(Span<const TestType>(values.data(), values.size()), Span<TestType>(out.data(), out.size()));
+    REQUIRE(std::vector<TestType>(out.begin(), out.begin() + count) == expected);
+    REQUIRE(out[count] == TestType(0x5A));
+  }
+}
+
+TEMPLATE_TEST_CASE("Byte swapping spans at unaligned addresses", "[Core.Endian]",
+  uint16, uint32, uint64) {
+  const auto values = make_values<TestType>(200);
+  const auto expected = swapped_one_by_one(values);
+
+  for(usize offset = 1; offset < sizeof(TestType); offset++) {
+    std::vector<uint8> raw(values.size() * sizeof(TestType) + sizeof(TestType));
+    std::memcpy(raw.data() + offset, values.data(), values.size() * sizeof(TestType));
+
+    auto* data = reinterpret_cast<TestType*>(raw.data() + offset);
+    byteswap(Span<TestType>(data, values.size()));
+
+    std::vector<TestType> result(values.size());
+    std::memcpy(result.data(), raw.data() + offset, values.size() * sizeof(TestType));
+    REQUIRE(result == expected);
+  }
+}
+
+TEST_CASE("Byte swapping span kernels", "[Core.Endian]") {
+  const auto values = make_values<uint32>(301);
+  const auto expected = swapped_one_by_one(values);
+
+  std::vector<uint32> out(values.size());
+  detail_::byteswap_scalar<4>(values.data(), out.data(), values.size());
+  REQUIRE(out == expected);
+
+#  if defined(ARCH_X86_64)
+  if(x86_64::cpu_has_ssse3()) {
+    std::fill(out.begin(), out.end(), 0);
+    detail_::byteswap_ssse3<4>(values.data(), out.data(), values.size());
+    REQUIRE(out == expected);
+  }
+
+  if(x86_64::cpu_has_avx2()) {
+    std::fill(out.begin(), out.end(), 0);
+    detail_::byteswap_avx2<4>(values.data(), out.data(), values.size());
+    REQUIRE(out == expected);
+  }
+#  endif
+}
+
+TEST_CASE("Endian conversions over spans", "[Core.Endian]") {
+  const auto values = make_values<uint32>(77);
+  const Span<const uint32> src(values.data(), values.size());
+
+  std::vector<uint32> big(values.size()), back(values.size());
+  host_to_big(src, Span<uint32>(big.data(), big.size()));
+  for(usize i = 0; i < values.size(); i++) REQUIRE(big[i] == host_to_big(values[i]));
+
+  big_to_host(Span<const uint32>(big.data(), big.size()), Span<uint32>(back.data(), back.size()));
+  REQUIRE(back == values);
+
+  std::vector<uint32> little(values.size());
+  host_to_little(src, Span<uint32>(little.data(), little.size()));
+  for(usize i = 0; i < values.size(); i++) REQUIRE(little[i] == host_to_little(values[i]));
+
+  auto in_place = values;
+  Span<uint32> span(in_place.data(), in_place.size());
+  host_to_big(span);
+  REQUIRE(in_place == big);
+  big_to_host(span);
+  REQUIRE(in_place == values);
+  host_to_little(span);
+  little_to_host(span);
+  REQUIRE(in_place == values);
+}
@@ -62,3 +62,64 @@ TEST_CASE("Vendor String", "[Arch.x86_64.CPUID]") {
   }
 }
 
+
+TEST_CASE("Decoded feature set", "[Arch.x86_64.CPUID]") {
+  const CpuFeatures& features = cpu_features();
+  REQUIRE(&features == &cpu_features());
+
+  /// Every x86_64 CPU has these.
+  REQUIRE(features.has_sse2());
+  REQUIRE(features.has_lm());
+
+  /// Leaf 1 bits agree with a raw query, except the ones masked by XCR0.
+  const CPUID leaf1 = CPUID::get_processor_info();
+  REQUIRE(features.has_sse4_2() == leaf1.has_sse4_2());
+  REQUIRE(features.has_osxsave() == leaf1.has_osxsave());
+  if(features.has_avx()) REQUIRE(leaf1.has_avx());
+
+  /// OS support: AVX needs YMM state, AVX-512 needs ZMM state on top of that.
+  if(!features.has_osxsave()) REQUIRE(features.xcr0() == 0);
+  if(features.has_avx() || features.has_avx2() || features.has_fma()) {
+    REQUIRE((features.xcr0() & 0x6) == 0x6);
+  }
+  if(features.has_avx512f() || features.has_avx512bw() || features.has_avx512vl()) {
+    REQUIRE((features.xcr0() & 0xE6) == 0xE6);
+    REQUIRE(features.has_avx());
+  }
+
+  /// Detecting again gives the same answer as the cached copy.
+  const CpuFeatures again = CpuFeatures::detect();
+#define X(IDENT, VAL, STR) REQUIRE(again.has_##IDENT() == features.has_##IDENT());
+  CPUID_ALL_FEATURES_LIST_
+#undef X
+
+  std::cout << "---- decoded features (xcr0 = " << features.xcr0() << "):\n";
+#define X(IDENT, VAL, STR) if(features.has_##IDENT()) std::cout << #IDENT " ";
+  CPUID_LEAF7_EBX_FEATURES_LIST_
+  CPUID_LEAF7_ECX_FEATURES_LIST_
+  CPUID_LEAF7_EDX_FEATURES_LIST_
+  CPUID_LEAF7_1_EAX_FEATURES_LIST_
+  CPUID_EXT_ECX_FEATURES_LIST_
+  CPUID_EXT_EDX_FEATURES_LIST_
+#undef X
+  std::cout << std::endl;
+}
+
+TEST_CASE("Decoded feature names", "[Arch.x86_64.CPUID]") {
+  using Feature = CpuFeatures::Feature;
+  REQUIRE(std::string(CpuFeatures::feature_to_string(Feature::avx2)) == "avx2");
+  REQUIRE(std::string(CpuFeatures::feature_to_string(Feature::sse3)) == "sse3");
+  REQUIRE(std::string(CpuFeatures::get_feature_desc(Feature::fsrm)) == "Fast Short REP MOVSB");
+  REQUIRE(std::string(CpuFeatures::get_feature_desc(Feature::lzcnt)) == "LZCNT Instruction");
+
+  const CpuFeatures& features = cpu_features();
+  REQUIRE(features.has_feature(Feature::avx2) == features.has_avx2());
+  REQUIRE(features.has_feature(Feature::bmi2) == features.has_bmi2());
+  REQUIRE(features.has_feature(Feature::erms) == features.has_erms());
+
+  /// Nothing detected yet: no features at all.
+  const CpuFeatures empty;
+  REQUIRE_FALSE(empty.has_sse2());
+  REQUIRE_FALSE(empty.has_avx2());
+  REQUIRE(empty.xcr0() == 0);
+}
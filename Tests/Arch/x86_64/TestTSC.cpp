@@ -0,0 +1,52 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Arch/x86_64/TSC.hpp>
+
+#include <iostream>
+#include <time.h>
+
+using namespace kta::x86_64;
+
+namespace {
+  auto now_ns() -> uint64 {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64>(ts.tv_sec) * 1'000'000'000 + static_cast<uint64>(ts.tv_nsec);
+  }
+}
+
+TEST_CASE("TSC reads move forward", "[Arch.x86_64.TSC]") {
+  const uint64 a = rdtsc();
+  const uint64 b = rdtsc_ordered();
+  const uint64 c = rdtscp();
+  REQUIRE(b >= a);
+  REQUIRE(c >= b);
+
+  uint32 aux = 0xFFFFFFFF;
+  const uint64 d = rdtscp(aux);
+  REQUIRE(d >= c);
+}
+
+TEST_CASE("TSC frequency", "[Arch.x86_64.TSC]") {
+  const uint64 reported   = tsc_frequency_from_cpuid();
+  const uint64 calibrated = calibrate_tsc_frequency(&now_ns, 20'000'000);
+
+  std::cout << "---- tsc: invariant = " << has_invariant_tsc()
+            << ", cpuid = " << reported << " Hz, calibrated = " << calibrated << " Hz\n";
+  std::cout.flush();
+
+  /// Anything from 100 MHz to 10 GHz is plausible.
+  REQUIRE(calibrated > 100'000'000);
+  REQUIRE(calibrated < 10'000'000'000);
+
+  /// Where cpuid reports a frequency, it should be close to the measured one.
+  if(reported != 0 && has_invariant_tsc()) {
+    const uint64 diff = reported > calibrated ? reported - calibrated : calibrated - reported;
+    REQUIRE(diff < reported / 20);
+  }
+}
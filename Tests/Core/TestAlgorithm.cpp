@@ -7,8 +7,37 @@
 #include <catch2/catch_test_macros.hpp>
 #include <Kalantha/Core/Algorithm.hpp>
 
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <string>
+
 using namespace kta;
 
+namespace {
+  /// The distributions pdqsort has special cases for, plus random.
+  auto make_keys(const std::string& kind, usize n, uint32 seed) -> std::vector<int64> {
+    std::mt19937_64 rng(seed);
+    std::vector<int64> keys(n);
+    for(usize i = 0; i < n; i++) {
+      const int64 v = static_cast<int64>(i);
+      if(kind == "random")          keys[i] = static_cast<int64>(rng());
+      else if(kind == "sorted")     keys[i] = v;
+      else if(kind == "reverse")    keys[i] = -v;
+      else if(kind == "duplicates") keys[i] = static_cast<int64>(rng() % 4);
+      else if(kind == "organ")      keys[i] = i < n / 2 ? v : static_cast<int64>(n) - v;
+      else if(kind == "sawtooth")   keys[i] = v % 97;
+    }
+    if(kind == "sorted" && n > 10) keys[n / 3] = 0;
+    return keys;
+  }
+
+  struct Record {
+    int32 key;
+    uint32 index;
+  };
+}
+
 TEST_CASE("min returns the smaller value", "[Core.Algorithm]") {
   REQUIRE(::kta::min(5, 10) == 5);
   REQUIRE(::kta::min(10, 5) == 5);
@@ -24,3 +53,279 @@ TEST_CASE("clamp limits the value within bounds", "[Core.Algorithm]") {
   REQUIRE(::kta::clamp(-5, 0, 10) == 0);
   REQUIRE(::kta::clamp(15, 0, 10) == 10);
 }
+
+TEST_CASE("for_each and transform visit every element", "[Core.Algorithm]") {
+  int values[] = {1, 2, 3, 4, 5};
+  for_each(Span<int>(values), [](int& v) { v *= 2; });
+  REQUIRE(values[4] == 10);
+
+  int squares[8] = {};
+  Span<int> written = transform(Span<int>(values), Span<int>(squares), [](int v) { return v * v; });
+  REQUIRE(written.size() == 5);
+  REQUIRE(squares[0] == 4);
+  REQUIRE(squares[4] == 100);
+  REQUIRE(squares[5] == 0);
+
+  /// In place.
+  transform(Span<int>(values), Span<int>(values), [](int v) { return v + 1; });
+  REQUIRE(values[0] == 3);
+}
+
+TEST_CASE("reduce folds a range", "[Core.Algorithm]") {
+  uint8 bytes[37];
+  for(usize i = 0; i < 37; i++) bytes[i] = static_cast<uint8>(200 + i);
+
+  /// Accumulates in the init type, so nothing wraps at 8 bits.
+  uint64 expected = 0;
+  for(uint8 b : bytes) expected += b;
+  REQUIRE(reduce(Span<const uint8>(bytes), uint64(0)) == expected);
+  REQUIRE(reduce(Span<const uint8>(bytes, 3), uint64(10)) == 10 + 200 + 201 + 202);
+  REQUIRE(reduce(Span<const uint8>(), uint64(7)) == 7);
+
+  int values[] = {4, 9, -3, 12, 7, 0, 5, 11, 2};
+  auto max_op = [](int a, int b) { return a < b ? b : a; };
+  REQUIRE(reduce(Span<int>(values), -100, max_op) == 12);
+}
+
+TEST_CASE("inclusive_scan computes prefix sums", "[Core.Algorithm]") {
+  int values[] = {1, 2, 3, 4, 5, 6};
+  int out[6]   = {};
+  inclusive_scan(Span<int>(values), Span<int>(out));
+  REQUIRE(out[0] == 1);
+  REQUIRE(out[2] == 6);
+  REQUIRE(out[5] == 21);
+
+  inclusive_scan(Span<int>(values), Span<int>(values), [](int a, int b) { return a * b; });
+  REQUIRE(values[5] == 720);
+  REQUIRE(inclusive_scan(Span<int>(), Span<int>(out)).empty());
+}
+
+TEST_CASE("count_if counts matching elements", "[Core.Algorithm]") {
+  int values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  REQUIRE(count_if(Span<int>(values), [](int v) { return v % 3 == 0; }) == 3);
+  REQUIRE(count_if(Span<int>(), [](int) { return true; }) == 0);
+}
+
+TEST_CASE("sort matches std::sort on every distribution", "[Core.Algorithm]") {
+  const char* kinds[] = {"random", "sorted", "reverse", "duplicates", "organ", "sawtooth"};
+  for(const char* kind : kinds) {
+    for(usize n : {usize(0), usize(1), usize(2), usize(23), usize(24), usize(129), usize(1000), usize(100'000)}) {
+      auto keys     = make_keys(kind, n, static_cast<uint32>(n));
+      auto expected = keys;
+      std::sort(expected.begin(), expected.end());
+
+      kta::sort(Span<int64>(keys.data(), n));
+      REQUIRE(keys == expected);
+    }
+  }
+}
+
+TEST_CASE("sort with a custom comparator", "[Core.Algorithm]") {
+  auto keys = make_keys("random", 5000, 7);
+  kta::sort(Span<int64>(keys.data(), keys.size()), [](int64 a, int64 b) { return a > b; });
+  REQUIRE(std::is_sorted(keys.begin(), keys.end(), [](int64 a, int64 b) { return a > b; }));
+
+  const char* fruit[] = {"pear", "apple", "fig", "kiwi", "banana", "cherry", "date"};
+  std::vector<std::string> words;
+  for(int i = 0; i < 300; i++) words.emplace_back(fruit[(i * 5) % 7]);
+  kta::sort(Span<std::string>(words.data(), words.size()));
+  REQUIRE(std::is_sorted(words.begin(), words.end()));
+  REQUIRE(words.front() == "apple");
+}
+
+TEST_CASE("stable_sort keeps equal keys in order", "[Core.Algorithm]") {
+  for(usize n : {usize(0), usize(1), usize(31), usize(33), usize(100), usize(10'000)}) {
+    std::mt19937 rng(static_cast<uint32>(n));
+    std::vector<Record> records(n);
+    for(usize i = 0; i < n; i++) records[i] = Record{static_cast<int32>(rng() % 16), static_cast<uint32>(i)};
+
+    auto by_key = [](const Record& a, const Record& b) { return a.key < b.key; };
+    auto check = [&](const std::vector<Record>& sorted) {
+      for(usize i = 1; i < sorted.size(); i++) {
+        if(sorted[i - 1].key > sorted[i].key) return false;
+        if(sorted[i - 1].key == sorted[i].key && sorted[i - 1].index > sorted[i].index) return false;
+      }
+      return true;
+    };
+
+    /// Enough scratch, too little scratch, and none at all.
+    auto with_scratch = records;
+    std::vector<Record> scratch((n + 1) / 2);
+    stable_sort(Span<Record>(with_scratch.data(), n), Span<Record>(scratch.data(), scratch.size()), by_key);
+    REQUIRE(check(with_scratch));
+
+    auto small_scratch = records;
+    std::vector<Record> small(8);
+    stable_sort(Span<Record>(small_scratch.data(), n), Span<Record>(small.data(), small.size()), by_key);
+    REQUIRE(check(small_scratch));
+
+    auto in_place = records;
+    stable_sort(Span<Record>(in_place.data(), n), by_key);
+    REQUIRE(check(in_place));
+  }
+}
+
+TEST_CASE("radix_sort sorts integer and floating point keys", "[Core.Algorithm]") {
+  std::mt19937_64 rng(42);
+
+  SECTION("unsigned and signed integers") {
+    std::vector<uint32> u(20'000), u_scratch(u.size());
+    for(auto& v : u) v = static_cast<uint32>(rng());
+    auto u_expected = u;
+    std::sort(u_expected.begin(), u_expected.end());
+    radix_sort(Span<uint32>(u.data(), u.size()), Span<uint32>(u_scratch.data(), u_scratch.size()));
+    REQUIRE(u == u_expected);
+
+    std::vector<int64> s(20'000), s_scratch(s.size());
+    for(auto& v : s) v = static_cast<int64>(rng()) >> (rng() % 60);
+    auto s_expected = s;
+    std::sort(s_expected.begin(), s_expected.end());
+    radix_sort(Span<int64>(s.data(), s.size()), Span<int64>(s_scratch.data(), s_scratch.size()));
+    REQUIRE(s == s_expected);
+
+    int8 small[] = {5, -128, 127, 0, -1, 3, -7, 0};
+    int8 small_scratch[8];
+    radix_sort(Span<int8>(small), Span<int8>(small_scratch));
+    REQUIRE(std::is_sorted(std::begin(small), std::end(small)));
+    REQUIRE(small[0] == -128);
+  }
+
+  SECTION("floats and doubles") {
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::vector<double> d(10'000), d_scratch(d.size());
+    for(auto& v : d) v = dist(rng);
+    d[0] = 0.0; d[1] = -0.5; d[2] = 1e300; d[3] = -1e300;
+    auto d_expected = d;
+    std::sort(d_expected.begin(), d_expected.end());
+    radix_sort(Span<double>(d.data(), d.size()), Span<double>(d_scratch.data(), d_scratch.size()));
+    REQUIRE(d == d_expected);
+
+    float f[] = {3.5f, -2.0f, 0.0f, -100.25f, 1e-30f, -1e-30f, 7.0f};
+    float f_scratch[7];
+    radix_sort(Span<float>(f), Span<float>(f_scratch));
+    REQUIRE(std::is_sorted(std::begin(f), std::end(f)));
+  }
+
+  SECTION("passes where every key shares a byte are skipped") {
+    /// Only the low byte varies, so the result lands after one pass,
+    /// in the scratch buffer, and has to be copied back.
+    std::vector<uint64> keys(1000), scratch(1000);
+    for(usize i = 0; i < keys.size(); i++) keys[i] = 0xABCD'0000'0000'0000ULL | (rng() & 0xFF);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(Span<uint64>(keys.data(), keys.size()), Span<uint64>(scratch.data(), scratch.size()));
+    REQUIRE(keys == expected);
+  }
+}
+
+TEST_CASE("lower_bound, upper_bound and binary_search", "[Core.Algorithm]") {
+  const int values[] = {1, 3, 3, 3, 7, 9, 12};
+  Span<const int> span(values);
+
+  REQUIRE(lower_bound(span, 0) == 0);
+  REQUIRE(lower_bound(span, 3) == 1);
+  REQUIRE(upper_bound(span, 3) == 4);
+  REQUIRE(lower_bound(span, 8) == 5);
+  REQUIRE(lower_bound(span, 12) == 6);
+  REQUIRE(lower_bound(span, 13) == 7);
+  REQUIRE(upper_bound(span, 12) == 7);
+  REQUIRE(binary_search(span, 7));
+  REQUIRE_FALSE(binary_search(span, 8));
+  REQUIRE_FALSE(binary_search(span, 100));
+
+  REQUIRE(lower_bound(Span<const int>(), 5) == 0);
+  REQUIRE_FALSE(binary_search(Span<const int>(), 5));
+
+  /// Every size and every probe against std::lower_bound.
+  for(usize n = 0; n < 70; n++) {
+    std::vector<int> keys(n);
+    for(usize i = 0; i < n; i++) keys[i] = static_cast<int>(i / 2) * 2;
+    Span<const int> s(keys.data(), n);
+    for(int probe = -1; probe <= static_cast<int>(n) + 1; probe++) {
+      const auto lo = static_cast<usize>(std::lower_bound(keys.begin(), keys.end(), probe) - keys.begin());
+      const auto hi = static_cast<usize>(std::upper_bound(keys.begin(), keys.end(), probe) - keys.begin());
+      REQUIRE(lower_bound(s, probe) == lo);
+      REQUIRE(upper_bound(s, probe) == hi);
+    }
+  }
+
+  static constexpr int table[] = {2, 4, 6, 8};
+  static_assert(lower_bound(Span<const int>(table), 5) == 2);
+}
+
+TEST_CASE("min_element, max_element and minmax", "[Core.Algorithm]") {
+  std::mt19937_64 rng(9);
+
+  auto check = [&](auto sample) {
+    using T = decltype(sample);
+    for(usize n : {usize(1), usize(3), usize(16), usize(31), usize(64), usize(65), usize(1000), usize(4099)}) {
+      std::vector<T> values(n);
+      for(auto& v : values) v = static_cast<T>(static_cast<int64>(rng() % 2001) - 1000);
+      Span<const T> span(values.data(), n);
+
+      const auto min_at = static_cast<usize>(std::min_element(values.begin(), values.end()) - values.begin());
+      const auto max_at = static_cast<usize>(std::max_element(values.begin(), values.end()) - values.begin());
+      REQUIRE(min_element(span) == min_at);
+      REQUIRE(max_element(span) == max_at);
+
+      auto both = minmax(span);
+      REQUIRE(both.has_value());
+      REQUIRE(both.value().min == values[min_at]);
+      REQUIRE(both.value().max == values[max_at]);
+    }
+  };
+
+  check(int8{});
+  check(uint8{});
+  check(int16{});
+  check(uint16{});
+  check(int32{});
+  check(uint32{});
+  check(int64{});
+  check(uint64{});
+  check(float{});
+  check(double{});
+
+  REQUIRE(min_element(Span<const int>()) == 0);
+  REQUIRE_FALSE(minmax(Span<const int>()).has_value());
+
+  /// Ties go to the first occurrence.
+  const int ties[] = {5, 1, 9, 1, 9, 5};
+  REQUIRE(min_element(Span<const int>(ties)) == 1);
+  REQUIRE(max_element(Span<const int>(ties)) == 2);
+
+  const std::string words[] = {"kiwi", "apple", "pear"};
+  REQUIRE(min_element(Span<const std::string>(words)) == 1);
+  REQUIRE(minmax(Span<const std::string>(words)).value().max == "pear");
+}
+
+TEST_CASE("sum and count", "[Core.Algorithm]") {
+  std::vector<uint8> bytes(10'001);
+  for(usize i = 0; i < bytes.size(); i++) bytes[i] = static_cast<uint8>(i * 7);
+  uint64 expected = 0;
+  for(uint8 b : bytes) expected += b;
+  REQUIRE(sum(Span<const uint8>(bytes.data(), bytes.size())) == expected);
+  REQUIRE(count(Span<const uint8>(bytes.data(), bytes.size()), uint8(7)) == static_cast<usize>(std::count(bytes.begin(), bytes.end(), uint8(7))));
+
+  std::vector<int16> shorts(777);
+  for(usize i = 0; i < shorts.size(); i++) shorts[i] = static_cast<int16>(i % 2 ? -30000 : 29999);
+  REQUIRE(sum(Span<const int16>(shorts.data(), shorts.size())) == 389 * int64(29999) - 388 * int64(30000));
+  REQUIRE(count(Span<const int16>(shorts.data(), shorts.size()), int16(-30000)) == 388);
+
+  /// Small integer lanes must not overflow however many matches there are.
+  std::vector<int8> same(100'000, int8(-3));
+  REQUIRE(count(Span<const int8>(same.data(), same.size()), int8(-3)) == 100'000);
+  REQUIRE(sum(Span<const int8>(same.data(), same.size())) == -300'000);
+
+  std::vector<double> reals(1001);
+  for(usize i = 0; i < reals.size(); i++) reals[i] = 0.5 * static_cast<double>(i);
+  REQUIRE(sum(Span<const double>(reals.data(), reals.size())) == 250'250.0);
+  REQUIRE(count(Span<const double>(reals.data(), reals.size()), 10.0) == 1);
+
+  const float small[] = {1.5f, 2.5f, 4.0f};
+  REQUIRE(sum(Span<const float>(small)) == 8.0f);
+  REQUIRE(sum(Span<const float>()) == 0.0f);
+
+  const std::string words[] = {"a", "b", "a"};
+  REQUIRE(count(Span<const std::string>(words), std::string("a")) == 2);
+}
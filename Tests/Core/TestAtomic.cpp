@@ -0,0 +1,116 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Atomic.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace kta;
+
+TEST_CASE("Atomic pointer arithmetic", "[Core.Atomic]") {
+  uint64 array[8]{};
+  Atomic<uint64*> ptr(&array[0]);
+  REQUIRE(ptr.fetch_add(3) == &array[0]);
+  REQUIRE(ptr.load() == &array[3]);
+  REQUIRE(ptr.fetch_sub(1) == &array[3]);
+  REQUIRE(ptr.load() == &array[2]);
+}
+
+TEST_CASE("Atomic bitwise operations", "[Core.Atomic]") {
+  Atomic<uint8> flags(0b0101);
+  REQUIRE(flags.fetch_or(0b0010) == 0b0101);
+  REQUIRE(flags.fetch_and(0b0110) == 0b0111);
+  REQUIRE(flags.fetch_xor(0b1111) == 0b0110);
+  REQUIRE(flags.load() == 0b1001);
+  REQUIRE(Atomic<uint64>::is_always_lock_free);
+}
+
+TEST_CASE("Atomic of a trivially copyable struct", "[Core.Atomic]") {
+  struct Pair { uint32 a; uint32 b; };
+  Atomic<Pair> pair(Pair{1, 2});
+
+  Pair expected{1, 2};
+  REQUIRE(pair.compare_exchange_strong(expected, Pair{3, 4}));
+  REQUIRE(pair.load().a == 3);
+
+  expected = Pair{1, 2};
+  REQUIRE_FALSE(pair.compare_exchange_strong(expected, Pair{5, 6}));
+  REQUIRE(expected.b == 4);
+}
+
+TEST_CASE("Atomic wait and notify", "[Core.Atomic]") {
+  SECTION("32-bit values block") {
+    Atomic<uint32> flag(0);
+    Atomic<uint32> woken(0);
+    std::vector<std::thread> waiters;
+
+    for(int i = 0; i < 4; i++) {
+      waiters.emplace_back([&] {
+        flag.wait(0);
+        woken.fetch_add(1);
+      });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(woken.load() == 0);
+
+    flag.store(1);
+    flag.notify_all();
+    for(auto& t : waiters) t.join();
+    REQUIRE(woken.load() == 4);
+  }
+
+  SECTION("64-bit values poll") {
+    Atomic<uint64> value(1ULL << 40);
+    std::thread waiter([&] { value.wait(1ULL << 40); });
+
+    value.store((1ULL << 40) | 1);
+    value.notify_one();
+    waiter.join();
+    REQUIRE(value.load() == ((1ULL << 40) | 1));
+  }
+
+  SECTION("Ping-pong") {
+    Atomic<uint32> turn(0);
+    constexpr uint32 rounds = 1000;
+
+    std::thread other([&] {
+      for(uint32 i = 0; i < rounds; i++) {
+        turn.wait(2 * i);
+        turn.store(2 * i + 2);
+        turn.notify_one();
+      }
+    });
+
+    for(uint32 i = 0; i < rounds; i++) {
+      turn.store(2 * i + 1);
+      turn.notify_one();
+      turn.wait(2 * i + 1);
+    }
+
+    other.join();
+    REQUIRE(turn.load() == 2 * rounds);
+  }
+}
+
+TEST_CASE("Cache padding", "[Core.Atomic]") {
+  PaddedAtomic<uint32> counters[2];
+  const auto a = reinterpret_cast<uintptr>(&counters[0]);
+  const auto b = reinterpret_cast<uintptr>(&counters[1]);
+  REQUIRE(b - a == cache_line_size);
+  REQUIRE(a % cache_line_size == 0);
+
+  counters[1].fetch_add(5);
+  REQUIRE(counters[1].load() == 5);
+
+  CachePadded<int> padded(42);
+  REQUIRE(*padded == 42);
+  *padded = 7;
+  REQUIRE(padded.value == 7);
+  REQUIRE(alignof(CachePadded<int>) == cache_line_size);
+}
@@ -0,0 +1,101 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/ByteStream.hpp>
+
+using namespace kta;
+
+TEST_CASE("ByteWriter lays out fields in the chosen byte order", "[Core.ByteStream]") {
+  uint8 buffer[16]{};
+  ByteWriter writer(buffer);
+  REQUIRE(writer.remaining() == 16);
+
+  REQUIRE(writer.ensure(15).has_value());
+  writer.put_big<uint16>(0x0102);
+  writer.put_little<uint32>(0x03040506);
+  writer.put_big<int64>(-2);
+  writer.put_little<uint8>(0xAB);
+
+  REQUIRE(writer.position() == 15);
+  REQUIRE(writer.written().size() == 15);
+
+  const uint8 expected[] = {0x01, 0x02, 0x06, 0x05, 0x04, 0x03,
+                            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB};
+  for(usize i = 0; i < sizeof(expected); i++) REQUIRE(buffer[i] == expected[i]);
+
+  REQUIRE(writer.ensure(2).error().code == ErrC::Overflow);
+  REQUIRE(writer.write_little<uint16>(1).error().code == ErrC::Overflow);
+  REQUIRE(writer.position() == 15);
+  REQUIRE(writer.write_big<uint8>(7).has_value());
+  REQUIRE(writer.remaining() == 0);
+  REQUIRE(buffer[15] == 7);
+}
+
+TEST_CASE("ByteReader reads back what ByteWriter wrote", "[Core.ByteStream]") {
+  uint8 buffer[32]{};
+  const uint8 payload[] = {'k', 't', 'a'};
+
+  ByteWriter writer(buffer);
+  REQUIRE(writer.ensure(4 + 8 + 2 + 3).has_value());
+  writer.put_little<uint32>(0xDEADBEEF);
+  writer.put_big<uint64>(0x0123456789ABCDEFULL);
+  writer.put_little<int16>(-300);
+  writer.put_bytes(Span<const uint8>(payload));
+  const usize size = writer.position();
+
+  ByteReader reader(Span<const uint8>(buffer, size));
+  REQUIRE(reader.ensure(size).has_value());
+  REQUIRE(reader.get_little<uint32>() == 0xDEADBEEF);
+  REQUIRE(reader.get_big<uint64>() == 0x0123456789ABCDEFULL);
+  REQUIRE(reader.get_little<int16>() == -300);
+
+  /// Bytes come back as a view into the buffer.
+  const auto bytes = reader.get_bytes(3);
+  REQUIRE(bytes.data() == buffer + 14);
+  REQUIRE(bytes[2] == 'a');
+  REQUIRE(reader.at_end());
+}
+
+TEST_CASE("ByteReader reports underflow", "[Core.ByteStream]") {
+  const uint8 buffer[] = {0x00, 0x2A, 0x01, 0x02, 0x03};
+  ByteReader reader(buffer);
+
+  REQUIRE(reader.ensure(6).error().code == ErrC::Underflow);
+  REQUIRE(reader.read_big<uint16>().value() == 42);
+  REQUIRE(reader.read_little<uint32>().error().code == ErrC::Underflow);
+  REQUIRE(reader.position() == 2);
+
+  REQUIRE(reader.skip(1).has_value());
+  REQUIRE(reader.read_bytes(3).error().code == ErrC::Underflow);
+  REQUIRE(reader.read_bytes(2).value().size() == 2);
+  REQUIRE(reader.at_end());
+  REQUIRE(reader.skip(1).error().code == ErrC::Underflow);
+  REQUIRE(reader.read_little<uint8>().has_error());
+}
+
+TEST_CASE("ByteWriter on an empty buffer", "[Core.ByteStream]") {
+  ByteWriter writer{Span<uint8>{}};
+  REQUIRE(writer.ensure(0).has_value());
+  REQUIRE(writer.write_bytes(Span<const uint8>{}).has_value());
+  REQUIRE(writer.write_little<uint8>(1).error().code == ErrC::Overflow);
+  REQUIRE(writer.written().empty());
+}
+
+TEST_CASE("ByteWriter and ByteReader varints", "[Core.ByteStream]") {
+  uint8 buffer[8]{};
+  ByteWriter writer(buffer);
+  REQUIRE(writer.write_varint(uint32(300)).has_value());
+  REQUIRE(writer.write_varint(uint64(1)).has_value());
+  REQUIRE(writer.write_varint(uint64(1) << 40).error().code == ErrC::Overflow);
+  REQUIRE(writer.position() == 3);
+
+  ByteReader reader(Span<const uint8>(buffer, writer.position()));
+  REQUIRE(reader.read_varint<uint32>().value() == 300);
+  REQUIRE(reader.read_varint<uint64>().value() == 1);
+  REQUIRE(reader.read_varint<uint32>().error().code == ErrC::Underflow);
+  REQUIRE(reader.at_end());
+}
@@ -0,0 +1,76 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/CRC32C.hpp>
+#include <Kalantha/Core/StringView.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <vector>
+
+using namespace kta;
+
+namespace {
+  using kta_tests::random_bytes;
+
+  auto finalize(detail_::Crc32cFn_ fn, const uint8* data, usize len) -> uint32 {
+    return ~fn(~0u, data, len);
+  }
+}
+
+TEST_CASE("CRC32C known values", "[Core.CRC32C]") {
+  using namespace kta::string_literals;
+  const auto check = "123456789"_sv;
+  REQUIRE(crc32c(check.data(), check.size()) == 0xE3069283);
+  REQUIRE(crc32c(nullptr, 0) == 0);
+
+  /// Test vectors from RFC 3720, B.4.
+  uint8 buffer[32];
+  __builtin_memset(buffer, 0, sizeof(buffer));
+  REQUIRE(crc32c(buffer, sizeof(buffer)) == 0x8A9136AA);
+
+  __builtin_memset(buffer, 0xFF, sizeof(buffer));
+  REQUIRE(crc32c(buffer, sizeof(buffer)) == 0x62A8AB43);
+
+  for(uint8 i = 0; i < 32; i++) buffer[i] = i;
+  REQUIRE(crc32c(buffer, sizeof(buffer)) == 0x46DD794E);
+
+  for(uint8 i = 0; i < 32; i++) buffer[i] = 31 - i;
+  REQUIRE(crc32c(buffer, sizeof(buffer)) == 0x113FDB5C);
+}
+
+TEST_CASE("CRC32C incremental and combine", "[Core.CRC32C]") {
+  const auto bytes = random_bytes(20000, 1);
+  const uint32 whole = crc32c(bytes.data(), bytes.size());
+
+  for(usize split : {0, 1, 7, 100, 4096, 12288, 19999, 20000}) {
+    const uint32 first  = crc32c(bytes.data(), split);
+    const uint32 second = crc32c(bytes.data() + split, bytes.size() - split);
+    REQUIRE(crc32c(bytes.data() + split, bytes.size() - split, first) == whole);
+    REQUIRE(crc32c_combine(first, second, bytes.size() - split) == whole);
+  }
+}
+
+TEST_CASE("CRC32C implementations agree", "[Core.CRC32C]") {
+  const auto bytes = random_bytes(3 * 4096 * 3 + 1000, 2);
+
+  std::vector<detail_::Crc32cFn_> impls;
+#if defined(ARCH_X86_64)
+  const auto& info = x86_64::cpu_features();
+  if(info.has_sse4_2()) impls.push_back(&detail_::crc32c_hw_<detail_::Crc32cShiftSoft_>);
+  if(info.has_sse4_2() && info.has_pclmul()) impls.push_back(&detail_::crc32c_hw_<detail_::Crc32cShiftClmul_>);
+  if(info.has_sse4_2()) impls.push_back(&detail_::crc32c_sse42_);
+#endif
+
+  for(usize offset = 0; offset < 8; offset += 3) {
+    for(usize len = 0; len + offset <= bytes.size(); len += (len < 1024 ? 1 : 997)) {
+      const uint8* data = bytes.data() + offset;
+      const uint32 expected = finalize(&detail_::crc32c_sw_, data, len);
+      REQUIRE(crc32c(data, len) == expected);
+      for(auto fn : impls) REQUIRE(finalize(fn, data, len) == expected);
+    }
+  }
+}
@@ -0,0 +1,219 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/FlatHashMap.hpp>
+#include <Kalantha/Core/FlatHashSet.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+using namespace kta;
+
+namespace {
+  using kta_tests::ArenaFixture;
+
+  /// An owning key type that can be looked up through a StringView.
+  struct OwnedKey {
+    std::string str;
+    OwnedKey(const char* s) : str(s) {}
+    operator StringView() const { return StringView(str.data(), str.size()); }
+  };
+
+  /// Forces every key into the same group to exercise probing and tombstones.
+  struct CollidingHash {
+    auto operator()(int) const -> uint64 { return 0x2A; }
+  };
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap insert and find", "[Core.FlatHashMap]") {
+  FlatHashMap<int, int> map(&arena);
+  REQUIRE(map.empty());
+  REQUIRE(map.find(1) == nullptr);
+
+  for(int i = 0; i < 1000; i++) {
+    auto res = map.emplace(i, i * 2);
+    REQUIRE(res.has_value());
+    REQUIRE(res.value().inserted);
+  }
+
+  REQUIRE(map.size() == 1000);
+  for(int i = 0; i < 1000; i++) {
+    int* value = map.find(i);
+    REQUIRE(value != nullptr);
+    REQUIRE(*value == i * 2);
+  }
+
+  REQUIRE(map.find(1000) == nullptr);
+  REQUIRE_FALSE(map.contains(-1));
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap does not overwrite on emplace", "[Core.FlatHashMap]") {
+  FlatHashMap<int, int> map(&arena);
+  REQUIRE(map.emplace(7, 1).has_value());
+
+  auto res = map.emplace(7, 2);
+  REQUIRE(res.has_value());
+  REQUIRE_FALSE(res.value().inserted);
+  REQUIRE(res.value().slot->value == 1);
+
+  REQUIRE(map.insert_or_assign(7, 3).has_value());
+  REQUIRE(*map.find(7) == 3);
+  REQUIRE(map.size() == 1);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap erase", "[Core.FlatHashMap]") {
+  FlatHashMap<int, int> map(&arena);
+  for(int i = 0; i < 200; i++) REQUIRE(map.emplace(i, i).has_value());
+
+  for(int i = 0; i < 200; i += 2) REQUIRE(map.erase(i));
+  REQUIRE_FALSE(map.erase(0));
+  REQUIRE(map.size() == 100);
+
+  for(int i = 0; i < 200; i++) {
+    REQUIRE(map.contains(i) == (i % 2 == 1));
+  }
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap probing with full collisions", "[Core.FlatHashMap]") {
+  FlatHashMap<int, int, CollidingHash> map(&arena);
+  for(int i = 0; i < 64; i++) REQUIRE(map.emplace(i, -i).has_value());
+
+  /// Erase from the first (full) group, keys past it must stay reachable.
+  for(int i = 0; i < 8; i++) REQUIRE(map.erase(i));
+  for(int i = 8; i < 64; i++) {
+    REQUIRE(map.find(i) != nullptr);
+    REQUIRE(*map.find(i) == -i);
+  }
+
+  /// Re-inserting reuses the tombstones.
+  const usize cap = map.capacity();
+  for(int i = 0; i < 8; i++) REQUIRE(map.emplace(i, i).has_value());
+  REQUIRE(map.capacity() == cap);
+  REQUIRE(map.size() == 64);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap heterogeneous lookup", "[Core.FlatHashMap]") {
+  FlatHashMap<OwnedKey, int, StringHash, StringEqual> map(&arena);
+  REQUIRE(map.emplace(OwnedKey("alpha"), 1).has_value());
+  REQUIRE(map.emplace(OwnedKey("beta"), 2).has_value());
+
+  using namespace kta::string_literals;
+  REQUIRE(map.find("alpha"_sv) != nullptr);
+  REQUIRE(*map.find("beta"_sv) == 2);
+  REQUIRE_FALSE(map.contains("gamma"_sv));
+
+  REQUIRE(map.erase("alpha"_sv));
+  REQUIRE(map.size() == 1);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap matches std::unordered_map", "[Core.FlatHashMap]") {
+  FlatHashMap<uint64, uint64> map(&arena);
+  std::unordered_map<uint64, uint64> reference;
+  std::mt19937_64 rng(1234);
+
+  for(int i = 0; i < 20000; i++) {
+    const uint64 key = rng() % 4096;
+    switch(rng() % 3) {
+      case 0: {
+        REQUIRE(map.insert_or_assign(key, i).has_value());
+        reference[key] = i;
+        break;
+      }
+      case 1: {
+        REQUIRE(map.erase(key) == (reference.erase(key) == 1));
+        break;
+      }
+      default: {
+        auto it = reference.find(key);
+        uint64* value = map.find(key);
+        REQUIRE((value != nullptr) == (it != reference.end()));
+        if(value != nullptr) REQUIRE(*value == it->second);
+        break;
+      }
+    }
+  }
+
+  REQUIRE(map.size() == reference.size());
+
+  usize visited = 0;
+  for(auto& entry : map) {
+    REQUIRE(reference.at(entry.key()) == entry.value);
+    ++visited;
+  }
+
+  REQUIRE(visited == reference.size());
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap reserve and clear", "[Core.FlatHashMap]") {
+  FlatHashMap<int, std::string> map(&arena);
+  REQUIRE(map.reserve(100).has_value());
+  const usize cap = map.capacity();
+  REQUIRE(cap >= 100);
+
+  for(int i = 0; i < 100; i++) REQUIRE(map.emplace(i, "some string long enough to allocate").has_value());
+  REQUIRE(map.capacity() == cap);
+
+  map.clear();
+  REQUIRE(map.empty());
+  REQUIRE(map.capacity() == cap);
+  REQUIRE(map.find(5) == nullptr);
+}
+
+TEST_CASE("FlatHashMap without an allocator", "[Core.FlatHashMap]") {
+  FlatHashMap<int, int> map;
+  auto res = map.emplace(1, 1);
+  REQUIRE_FALSE(res.has_value());
+  REQUIRE(res.error().code == ErrC::NoMemory);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashSet basic operations", "[Core.FlatHashSet]") {
+  FlatHashSet<uint32> set(&arena);
+  for(uint32 i = 0; i < 500; i++) REQUIRE(set.insert(i * 7).value());
+  REQUIRE_FALSE(set.insert(7).value());
+  REQUIRE(set.size() == 500);
+
+  REQUIRE(set.contains(14));
+  REQUIRE_FALSE(set.contains(15));
+  REQUIRE(set.erase(14));
+  REQUIRE_FALSE(set.contains(14));
+
+  usize count = 0;
+  for(uint32 key : set) {
+    REQUIRE(key % 7 == 0);
+    ++count;
+  }
+
+  REQUIRE(count == 499);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashSet of string views", "[Core.FlatHashSet]") {
+  using namespace kta::string_literals;
+  FlatHashSet<StringView, StringHash, StringEqual> set(&arena);
+
+  REQUIRE(set.insert("one"_sv).value());
+  REQUIRE(set.insert("two"_sv).value());
+  REQUIRE(set.contains("one"));
+  REQUIRE_FALSE(set.contains("three"));
+}
+
+TEST_CASE_METHOD(ArenaFixture, "FlatHashMap keys can't be modified in place", "[Core.FlatHashMap]") {
+  using Map = FlatHashMap<int, int>;
+  using Table = Map::TableType;
+  static_assert(std::is_same_v<decltype(std::declval<const Table&>().find(0)), const Map::EntryType*>);
+  static_assert(std::is_same_v<decltype(std::declval<Map::Iterator&>()->key()), const int&>);
+  static_assert(!std::is_assignable_v<decltype((std::declval<Map::Iterator&>()->key())), int>);
+
+  Map map(&arena);
+  REQUIRE(map.emplace(7, 1).has_value());
+  for(auto& entry : map) entry.value = 2;
+  REQUIRE(*map.find(7) == 2);
+}
@@ -0,0 +1,180 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Hash.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <vector>
+#include <string>
+#include <random>
+#include <unordered_set>
+#include <algorithm>
+
+using namespace kta;
+
+namespace {
+  using kta_tests::random_bytes;
+}
+
+TEST_CASE("Hash is deterministic and seed dependent", "[Core.Hash]") {
+  using namespace kta::string_literals;
+  REQUIRE(hash("hello world"_sv) == hash("hello world"_sv));
+  REQUIRE(hash("hello world"_sv) != hash("hello worle"_sv));
+  REQUIRE(hash("hello world"_sv, 1) != hash("hello world"_sv, 2));
+  REQUIRE(hash(uint64(42)) == hash(uint64(42)));
+  REQUIRE(hash(uint64(42), 1) != hash(uint64(42)));
+
+  /// Every length and both paths.
+  for(usize len : {0, 1, 3, 4, 8, 16, 17, 48, 49, 100, 256, 257, 1000, 5000}) {
+    const auto bytes = random_bytes(len, len);
+    const uint64 h = hash_bytes(bytes.data(), len);
+    REQUIRE(h == hash_bytes(bytes.data(), len));
+    REQUIRE(h != hash_bytes(bytes.data(), len, 0xDEADBEEF));
+    REQUIRE(h == Hash<Span<const uint8>>{}(Span<const uint8>(bytes.data(), len)));
+  }
+}
+
+TEST_CASE("Hash of zero-filled inputs depends on length", "[Core.Hash]") {
+  std::vector<uint8> zeros(2048, 0);
+  std::unordered_set<uint64> seen;
+  for(usize len = 0; len <= zeros.size(); len++) {
+    REQUIRE(seen.insert(hash_bytes(zeros.data(), len)).second);
+  }
+}
+
+TEST_CASE("Hash avalanche", "[Core.Hash]") {
+  /// Flipping any single input bit should flip each output bit about half the time.
+  for(usize len : {8, 32, 128, 512}) {
+    constexpr usize trials = 200;
+    usize flips[64]{};
+    usize total = 0;
+
+    for(usize t = 0; t < trials; t++) {
+      auto bytes = random_bytes(len, t * 31 + len);
+      const uint64 base = hash_bytes(bytes.data(), len);
+      for(usize bit = 0; bit < len * 8; bit += 7) {
+        bytes[bit / 8] ^= static_cast<uint8>(1u << (bit % 8));
+        const uint64 diff = base ^ hash_bytes(bytes.data(), len);
+        bytes[bit / 8] ^= static_cast<uint8>(1u << (bit % 8));
+        for(usize out = 0; out < 64; out++) flips[out] += (diff >> out) & 1;
+        ++total;
+      }
+    }
+
+    for(usize out = 0; out < 64; out++) {
+      const double ratio = static_cast<double>(flips[out]) / static_cast<double>(total);
+      REQUIRE(ratio > 0.45);
+      REQUIRE(ratio < 0.55);
+    }
+  }
+}
+
+TEST_CASE("Hash collisions on sequential keys", "[Core.Hash]") {
+  constexpr usize count = 1'000'000;
+  std::vector<uint64> full;
+  std::vector<uint32> low;
+  full.reserve(count);
+  low.reserve(count);
+
+  auto check = [&] {
+    std::sort(full.begin(), full.end());
+    REQUIRE(std::adjacent_find(full.begin(), full.end()) == full.end());
+
+    /// Birthday bound for 1M keys in 32 bits is ~116 collisions.
+    std::sort(low.begin(), low.end());
+    usize collisions = 0;
+    for(usize i = 1; i < low.size(); i++) collisions += low[i] == low[i - 1];
+    REQUIRE(collisions < 350);
+    full.clear();
+    low.clear();
+  };
+
+  SECTION("Integers") {
+    for(uint64 i = 0; i < count; i++) {
+      const uint64 h = hash(i);
+      full.push_back(h);
+      low.push_back(static_cast<uint32>(h));
+    }
+    check();
+  }
+
+  SECTION("Strings") {
+    std::string key;
+    for(usize i = 0; i < count; i++) {
+      key = "key_" + std::to_string(i);
+      const uint64 h = hash_bytes(key.data(), key.size());
+      full.push_back(h);
+      low.push_back(static_cast<uint32>(h));
+    }
+    check();
+  }
+}
+
+TEST_CASE("StreamingHasher matches one-shot hashing", "[Core.Hash]") {
+  const auto bytes = random_bytes(2200, 99);
+  std::mt19937_64 rng(7);
+
+  for(usize len = 0; len < bytes.size(); len += (len < 300 ? 1 : 37)) {
+    for(uint64 seed : {uint64(0), uint64(0x1234)}) {
+      const uint64 expected = hash_bytes(bytes.data(), len, seed);
+
+      StreamingHasher whole(seed);
+      whole.update(bytes.data(), len);
+      REQUIRE(whole.finish() == expected);
+
+      StreamingHasher pieces(seed);
+      usize at = 0;
+      while(at < len) {
+        const usize step = std::min<usize>(len - at, rng() % 300);
+        pieces.update(bytes.data() + at, step);
+        at += step;
+      }
+
+      REQUIRE(pieces.finish() == expected);
+    }
+  }
+
+  StreamingHasher hasher;
+  hasher.update(bytes.data(), 1000);
+  hasher.reset();
+  hasher.update(bytes.data(), 10);
+  REQUIRE(hasher.finish() == hash_bytes(bytes.data(), 10));
+}
+
+#if defined(ARCH_X86_64)
+TEST_CASE("Hash AVX2 and scalar paths agree", "[Core.Hash]") {
+  if(!x86_64::cpu_has_avx2()) {
+    SUCCEED("AVX2 not available");
+    return;
+  }
+
+  const auto bytes = random_bytes(64 * 40, 5);
+  for(uint64 seed : {uint64(0), uint64(77)}) {
+    const auto secret = seed ? detail_::seeded_secret_(seed) : detail_::hash_long_secret_;
+    for(usize index : {0, 5, 15}) {
+      uint64 scalar[8], avx2[8];
+      __builtin_memcpy(scalar, detail_::hash_acc_init_, sizeof(scalar));
+      __builtin_memcpy(avx2, detail_::hash_acc_init_, sizeof(avx2));
+
+      detail_::accumulate_scalar_(scalar, bytes.data(), 40, index, secret.words);
+      detail_::accumulate_avx2_(avx2, bytes.data(), 40, index, secret.words);
+      for(usize i = 0; i < 8; i++) REQUIRE(scalar[i] == avx2[i]);
+    }
+  }
+}
+#endif
+
+TEST_CASE("Hash policies", "[Core.Hash]") {
+  using namespace kta::string_literals;
+  REQUIRE(Hash<int>{}(5) == hash(5));
+  REQUIRE(Hash<StringView>{}("abc"_sv) == hash("abc"_sv));
+  REQUIRE(StringHash{}("abc") == StringHash{}("abc"_sv));
+  REQUIRE(StringEqual{}("abc", "abc"_sv));
+
+  int x = 0;
+  REQUIRE(Hash<int*>{}(&x) == hash(reinterpret_cast<uintptr>(&x)));
+}
@@ -0,0 +1,123 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Locks.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace kta;
+
+namespace {
+  /// A non-atomic read-modify-write that loses updates unless the lock works.
+  template<typename L>
+  auto hammer(L& lock, usize threads, uint64 iterations) -> uint64 {
+    volatile uint64 counter = 0;
+    std::vector<std::thread> pool;
+    for(usize t = 0; t < threads; t++) {
+      pool.emplace_back([&] {
+        for(uint64 i = 0; i < iterations; i++) {
+          LockGuard guard(lock);
+          counter = counter + 1;
+        }
+      });
+    }
+
+    for(auto& t : pool) t.join();
+    return counter;
+  }
+}
+
+TEST_CASE("SpinLock", "[Core.Locks]") {
+  SpinLock lock;
+  REQUIRE_FALSE(lock.is_locked());
+  REQUIRE(lock.try_lock());
+  REQUIRE(lock.is_locked());
+  REQUIRE_FALSE(lock.try_lock());
+  lock.unlock();
+
+  REQUIRE(hammer(lock, 4, 50'000) == 200'000);
+  REQUIRE_FALSE(lock.is_locked());
+}
+
+TEST_CASE("TicketLock", "[Core.Locks]") {
+  TicketLock lock;
+  REQUIRE(lock.try_lock());
+  REQUIRE_FALSE(lock.try_lock());
+  lock.unlock();
+  REQUIRE_FALSE(lock.is_locked());
+
+  REQUIRE(hammer(lock, 4, 50'000) == 200'000);
+  REQUIRE_FALSE(lock.is_locked());
+}
+
+TEST_CASE("McsLock", "[Core.Locks]") {
+  McsLock lock;
+  McsNode a, b;
+  REQUIRE(lock.try_lock(a));
+  REQUIRE_FALSE(lock.try_lock(b));
+  lock.unlock(a);
+  REQUIRE_FALSE(lock.is_locked());
+
+  REQUIRE(hammer(lock, 4, 50'000) == 200'000);
+  REQUIRE_FALSE(lock.is_locked());
+}
+
+TEST_CASE("Lock statistics", "[Core.Locks]") {
+  STATIC_REQUIRE(sizeof(SpinLock) == sizeof(Atomic<bool>));
+
+  SpinLock_<LockStats> spin;
+  TicketLock_<LockStats> ticket;
+  McsLock_<LockStats> mcs;
+
+  REQUIRE(hammer(spin, 4, 20'000) == 80'000);
+  REQUIRE(hammer(ticket, 4, 20'000) == 80'000);
+  REQUIRE(hammer(mcs, 4, 20'000) == 80'000);
+
+  REQUIRE(spin.stats().acquisitions.load() == 80'000);
+  REQUIRE(ticket.stats().acquisitions.load() == 80'000);
+  REQUIRE(mcs.stats().acquisitions.load() == 80'000);
+
+  for(const LockStats* stats : {&spin.stats(), &ticket.stats(), &mcs.stats()}) {
+    REQUIRE(stats->contended_acquisitions.load() <= stats->acquisitions.load());
+  }
+
+  SpinLock_<LockStats> quiet;
+  { LockGuard guard(quiet); }
+  REQUIRE(quiet.stats().acquisitions.load() == 1);
+  REQUIRE(quiet.stats().contended_acquisitions.load() == 0);
+}
+
+TEST_CASE("OnceFlag", "[Core.Locks]") {
+  static constinit OnceFlag flag;
+  REQUIRE_FALSE(flag.is_done());
+
+  /// The losers have to see everything the winner wrote before call() returns.
+  Atomic<uint32> runs{0};
+  uint64 value = 0;
+  std::vector<std::thread> pool;
+  std::vector<uint64> seen(4);
+  for(usize t = 0; t < 4; t++) {
+    pool.emplace_back([&, t] {
+      flag.call([&] {
+        runs.fetch_add(1, MemoryOrder::Relaxed);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        value = 42;
+      });
+      seen[t] = value;
+    });
+  }
+
+  for(auto& t : pool) t.join();
+  REQUIRE(runs.load() == 1);
+  REQUIRE(flag.is_done());
+  for(uint64 v : seen) REQUIRE(v == 42);
+
+  flag.call([&] { runs.fetch_add(1, MemoryOrder::Relaxed); });
+  REQUIRE(runs.load() == 1);
+}
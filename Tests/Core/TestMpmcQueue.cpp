@@ -0,0 +1,161 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/MpmcQueue.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+using namespace kta;
+
+namespace {
+  using kta_tests::ArenaFixture;
+}
+
+TEST_CASE_METHOD(ArenaFixture, "MpmcQueue init", "[Core.MpmcQueue]") {
+  MpmcQueue<int> queue(&arena);
+  REQUIRE(queue.capacity() == 0);
+
+  auto res = queue.init(12);
+  REQUIRE_FALSE(res.has_value());
+  REQUIRE(res.error().code == ErrC::InvalidArg);
+
+  REQUIRE(queue.init(16).has_value());
+  REQUIRE(queue.capacity() == 16);
+  REQUIRE_FALSE(queue.init(16).has_value());
+
+  /// reset() frees the cells, after which the queue can be set up again.
+  REQUIRE(queue.try_push(7));
+  queue.reset();
+  REQUIRE(queue.capacity() == 0);
+  REQUIRE_FALSE(queue.try_pop().has_value());
+  REQUIRE(queue.init(8).has_value());
+  REQUIRE(queue.capacity() == 8);
+  REQUIRE(queue.size_approx() == 0);
+
+  MpmcQueue<int> no_alloc;
+  REQUIRE(no_alloc.init(16).error().code == ErrC::NoMemory);
+
+  /// A queue without cells has no room, and nothing to take.
+  int values[4] = {1, 2, 3, 4};
+  REQUIRE_FALSE(no_alloc.try_push(1));
+  REQUIRE_FALSE(no_alloc.try_pop().has_value());
+  REQUIRE(no_alloc.push_batch(Span<const int>(values, 4)) == 0);
+  REQUIRE(no_alloc.pop_batch(Span<int>(values, 4)) == 0);
+  REQUIRE(no_alloc.size_approx() == 0);
+  REQUIRE(no_alloc.capacity() == 0);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "MpmcQueue push and pop", "[Core.MpmcQueue]") {
+  MpmcQueue<int> queue(&arena);
+  REQUIRE(queue.init(8).has_value());
+  REQUIRE_FALSE(queue.try_pop().has_value());
+
+  for(int i = 0; i < 8; i++) REQUIRE(queue.try_push(i));
+  REQUIRE_FALSE(queue.try_push(8));
+  REQUIRE(queue.size_approx() == 8);
+
+  for(int i = 0; i < 8; i++) REQUIRE(queue.try_pop().value() == i);
+  REQUIRE_FALSE(queue.try_pop().has_value());
+
+  for(int round = 0; round < 50; round++) {
+    REQUIRE(queue.try_push(round));
+    REQUIRE(queue.try_pop().value() == round);
+  }
+}
+
+TEST_CASE_METHOD(ArenaFixture, "MpmcQueue batches", "[Core.MpmcQueue]") {
+  MpmcQueue<int> queue(&arena);
+  REQUIRE(queue.init(16).has_value());
+
+  int in[20];
+  for(int i = 0; i < 20; i++) in[i] = i;
+  REQUIRE(queue.push_batch(Span<const int>(in, 10)) == 10);
+  REQUIRE(queue.push_batch(Span<const int>(in + 10, 10)) == 6);
+  REQUIRE(queue.push_batch(Span<const int>(in, 1)) == 0);
+
+  int out[20]{};
+  REQUIRE(queue.pop_batch(Span<int>(out, 5)) == 5);
+  REQUIRE(queue.pop_batch(Span<int>(out + 5, 20)) == 11);
+  for(int i = 0; i < 16; i++) REQUIRE(out[i] == i);
+  REQUIRE(queue.pop_batch(Span<int>(out, 20)) == 0);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "MpmcQueue destroys remaining elements", "[Core.MpmcQueue]") {
+  auto tracker = std::make_shared<int>(0);
+  {
+    MpmcQueue<std::shared_ptr<int>> queue(&arena);
+    REQUIRE(queue.init(4).has_value());
+    REQUIRE(queue.try_push(tracker));
+    REQUIRE(queue.try_push(tracker));
+    REQUIRE(tracker.use_count() == 3);
+  }
+
+  REQUIRE(tracker.use_count() == 1);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "MpmcQueue many producers and consumers", "[Core.MpmcQueue]") {
+  constexpr usize producers = 4;
+  constexpr usize consumers = 4;
+  constexpr uint64 per_producer = 200'000;
+
+  MpmcQueue<uint64> queue(&arena);
+  REQUIRE(queue.init(256).has_value());
+
+  std::atomic<uint64> popped{0};
+  std::atomic<uint64> sum{0};
+  std::vector<std::thread> threads;
+
+  for(usize p = 0; p < producers; p++) {
+    threads.emplace_back([&, p] {
+      uint64 batch[8];
+      uint64 next = 0;
+      while(next < per_producer) {
+        const uint64 base = p * per_producer;
+        if(p % 2 == 0) {
+          if(queue.try_push(base + next)) ++next;
+          continue;
+        }
+
+        const usize n = per_producer - next < 8 ? static_cast<usize>(per_producer - next) : 8;
+        for(usize i = 0; i < n; i++) batch[i] = base + next + i;
+        next += queue.push_batch(Span<const uint64>(batch, n));
+      }
+    });
+  }
+
+  for(usize c = 0; c < consumers; c++) {
+    threads.emplace_back([&, c] {
+      uint64 batch[8];
+      uint64 local_sum = 0;
+      while(popped.load() < producers * per_producer) {
+        usize n = 0;
+        if(c % 2 == 0) {
+          auto value = queue.try_pop();
+          if(value.has_value()) batch[n++] = value.value();
+        } else {
+          n = queue.pop_batch(Span<uint64>(batch, 8));
+        }
+
+        for(usize i = 0; i < n; i++) local_sum += batch[i];
+        if(n != 0) popped.fetch_add(n);
+      }
+
+      sum.fetch_add(local_sum);
+    });
+  }
+
+  for(auto& t : threads) t.join();
+
+  const uint64 total = producers * per_producer;
+  REQUIRE(popped.load() == total);
+  REQUIRE(sum.load() == total * (total - 1) / 2);
+  REQUIRE(queue.size_approx() == 0);
+}
@@ -6,6 +6,7 @@
 #define KTA_ASSUME_TESTING_ENV_
 #include <catch2/catch_test_macros.hpp>
 #include <Kalantha/Core/Option.hpp>
+#include <Kalantha/Core/StringView.hpp>
 #include <Kalantha/Core/Try.hpp>
 #include <Kalantha/Meta/TypeTraits.hpp>
 
@@ -23,6 +24,18 @@ struct CTORHelper2 {
   CTORHelper2(int x, int y) : x_(x), y_(y) {}
 };
 
+/// A handle type where ~0 means "no handle", opting into the niche.
+struct Handle {
+  uint64 bits = 0;
+};
+
+template<>
+struct kta::NicheTraits<Handle> {
+  static constexpr bool has_niche = true;
+  static auto niche() -> Handle { return Handle{~0ull}; }
+  static auto is_niche(const Handle& h) -> bool { return h.bits == ~0ull; }
+};
+
 struct DTORHelper1 {
   int& ref_;
   DTORHelper1(int& ref) : ref_(ref) {}
@@ -92,3 +105,73 @@ TEST_CASE("Operators", "[Core.Option]") {
   REQUIRE(has_cptr);
   REQUIRE(has_ptr);
 }
+
+static_assert(sizeof(Option<int*>) == sizeof(int*));
+static_assert(sizeof(Option<const char*>) == sizeof(const char*));
+static_assert(sizeof(Option<int&>) == sizeof(int*));
+static_assert(sizeof(Option<StringView>) == sizeof(StringView));
+static_assert(sizeof(Option<Handle>) == sizeof(Handle));
+static_assert(sizeof(Option<uint64>) == 2 * sizeof(uint64));
+static_assert(sizeof(Option<uint8>) == 2);
+
+TEST_CASE("Niche", "[Core.Option]") {
+  SECTION("Pointers") {
+    int x = 5;
+    Option<int*> empty;
+    Option<int*> null(nullptr);
+    Option<int*> some(&x);
+
+    REQUIRE_FALSE(empty.has_value());
+    REQUIRE(null.has_value());
+    REQUIRE(null.value() == nullptr);
+    REQUIRE(some.has_value());
+    REQUIRE(*some.value() == 5);
+
+    Option<int*> moved(kta::move(some));
+    REQUIRE(moved.has_value());
+    REQUIRE_FALSE(some.has_value());
+
+    empty = moved;
+    REQUIRE(empty.has_value());
+    REQUIRE(empty.value() == &x);
+    REQUIRE(empty.release_value() == &x);
+    REQUIRE_FALSE(empty.has_value());
+
+    moved.clear();
+    REQUIRE_FALSE(moved.has_value());
+    moved.emplace(nullptr);
+    REQUIRE(moved.has_value());
+  }
+
+  SECTION("References") {
+    int x = 1;
+    Option<int&> empty;
+    Option<int&> some(x);
+    REQUIRE_FALSE(empty.has_value());
+    REQUIRE(some.has_value());
+    some.value().get() = 2;
+    REQUIRE(x == 2);
+  }
+
+  SECTION("StringView") {
+    Option<StringView> empty;
+    Option<StringView> blank{StringView()};
+    Option<StringView> some{StringView("hello")};
+
+    REQUIRE_FALSE(empty.has_value());
+    REQUIRE(blank.has_value());
+    REQUIRE(blank.value().empty());
+    REQUIRE(some.has_value());
+    REQUIRE(some.value() == StringView("hello"));
+    REQUIRE_FALSE(Option<StringView>(None_{}).has_value());
+  }
+
+  SECTION("User specialization") {
+    Option<Handle> empty;
+    Option<Handle> zero(Handle{0});
+    REQUIRE_FALSE(empty.has_value());
+    REQUIRE(zero.has_value());
+    REQUIRE(zero.value().bits == 0);
+    REQUIRE(empty.value_or(Handle{7}).bits == 7);
+  }
+}
@@ -0,0 +1,186 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/ParallelAlgorithm.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace kta;
+
+namespace {
+  struct SchedulerFixture : kta_tests::ArenaFixture {
+    Scheduler sched;
+
+    SchedulerFixture() {
+      REQUIRE(sched.start(&arena, {.workers = 4}).has_value());
+    }
+  };
+
+  auto iota(usize n) -> std::vector<uint64> {
+    std::vector<uint64> values(n);
+    for(usize i = 0; i < n; i++) values[i] = i;
+    return values;
+  }
+
+  /// No default constructor, so reduce can't keep its partials in a plain array.
+  struct Sum {
+    uint64 value;
+    explicit Sum(uint64 v) : value(v) {}
+  };
+
+  /// x -> mul * x + add. Composing these is associative but not commutative.
+  struct Affine {
+    uint64 mul = 1;
+    uint64 add = 0;
+  };
+
+  auto then(Affine f, Affine g) -> Affine {
+    return Affine{g.mul * f.mul, g.mul * f.add + g.add};
+  }
+}
+
+TEST_CASE_METHOD(SchedulerFixture, "Parallel for_each and transform", "[Core.ParallelAlgorithm]") {
+  for(usize n : {usize(0), usize(1), usize(100), usize(100'003)}) {
+    auto values = iota(n);
+    Span<uint64> span(values.data(), values.size());
+
+    for_each(par(sched), span, [](uint64& v) { v *= 3; });
+    for_each(seq, span, [](uint64& v) { v += 1; });
+
+    std::vector<uint64> out(n + 1, 0);
+    Span<uint64> written = transform(par(sched, 64), Span<const uint64>(values.data(), n),
+      Span<uint64>(out.data(), out.size()), [](uint64 v) { return v * 2; });
+    REQUIRE(written.size() == n);
+
+    bool ok = out[n] == 0;
+    for(usize i = 0; i < n; i++) ok &= out[i] == (i * 3 + 1) * 2;
+    REQUIRE(ok);
+  }
+}
+
+TEST_CASE_METHOD(SchedulerFixture, "Parallel reduce and count_if", "[Core.ParallelAlgorithm]") {
+  for(usize n : {usize(0), usize(5), usize(1000), usize(1'000'000)}) {
+    auto values = iota(n);
+    Span<const uint64> span(values.data(), n);
+    const uint64 expected = n != 0 ? n * (n - 1) / 2 : 0;
+
+    REQUIRE(reduce(par(sched), span, uint64(0)) == expected);
+    REQUIRE(reduce(par(sched, 1), span, uint64(42)) == expected + 42);
+    REQUIRE(reduce(seq, span, uint64(0)) == expected);
+
+    auto max_op = [](uint64 a, uint64 b) { return a < b ? b : a; };
+    REQUIRE(reduce(par(sched), span, uint64(0), max_op) == (n != 0 ? n - 1 : 0));
+
+    auto is_odd = [](uint64 v) { return (v & 1) != 0; };
+    REQUIRE(count_if(par(sched), span, is_odd) == n / 2);
+    REQUIRE(count_if(par(sched, 3), span, is_odd) == count_if(seq, span, is_odd));
+  }
+}
+
+TEST_CASE_METHOD(SchedulerFixture, "Parallel reduce into a type without a default constructor", "[Core.ParallelAlgorithm]") {
+  auto values = iota(100'000);
+  Span<const uint64> span(values.data(), values.size());
+  auto add = [](Sum a, Sum b) { return Sum(a.value + b.value); };
+
+  std::vector<Sum> sums;
+  for(uint64 v : values) sums.emplace_back(v);
+  const Sum total = reduce(par(sched, 1000), Span<const Sum>(sums.data(), sums.size()), Sum(7), add);
+  REQUIRE(total.value == 100'000ull * 99'999 / 2 + 7);
+
+  std::vector<Sum> out(values.size(), Sum(0));
+  inclusive_scan(par(sched, 1000), span, Span<Sum>(out.data(), out.size()),
+    [](auto a, auto b) { return Sum(Sum(a).value + Sum(b).value); });
+  REQUIRE(out.back().value == 100'000ull * 99'999 / 2);
+}
+
+TEST_CASE_METHOD(SchedulerFixture, "Parallel sort", "[Core.ParallelAlgorithm]") {
+  std::mt19937_64 rng(0x5eed);
+  for(usize grain : {usize(0), usize(1), usize(1000)}) {
+    for(usize n : {usize(0), usize(1), usize(100), usize(300'007)}) {
+      std::vector<uint64> random(n), sorted, reverse, dups(n);
+      for(usize i = 0; i < n; i++) {
+        random[i] = rng();
+        dups[i]   = rng() % 4;
+      }
+      sorted = random;
+      std::sort(sorted.begin(), sorted.end());
+      reverse.assign(sorted.rbegin(), sorted.rend());
+
+      for(auto* input : {&random, &sorted, &reverse, &dups}) {
+        std::vector<uint64> expected = *input;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<uint64> values = *input;
+        sort(par(sched, grain), Span<uint64>(values.data(), n));
+        REQUIRE(values == expected);
+      }
+
+      /// A comparator that isn't Less, which takes the branchy partition.
+      std::vector<uint64> values = random;
+      sort(par(sched, grain), Span<uint64>(values.data(), n), [](uint64 a, uint64 b) { return a > b; });
+      REQUIRE(std::is_sorted(values.rbegin(), values.rend()));
+    }
+  }
+
+  auto values = iota(1000);
+  std::reverse(values.begin(), values.end());
+  sort(seq, Span<uint64>(values.data(), values.size()));
+  REQUIRE(values == iota(1000));
+}
+
+TEST_CASE_METHOD(SchedulerFixture, "Parallel inclusive_scan", "[Core.ParallelAlgorithm]") {
+  for(usize grain : {usize(0), usize(1), usize(7), usize(4096)}) {
+    for(usize n : {usize(1), usize(2), usize(300), usize(200'001)}) {
+      auto values = iota(n);
+      Span<const uint64> span(values.data(), n);
+
+      std::vector<uint64> out(n);
+      inclusive_scan(par(sched, grain), span, Span<uint64>(out.data(), n));
+
+      bool ok = true;
+      for(usize i = 0; i < n; i++) ok &= out[i] == i * (i + 1) / 2;
+      REQUIRE(ok);
+
+      /// In place, with a non-additive op.
+      Span<uint64> inout(values.data(), n);
+      inclusive_scan(par(sched, grain), inout, inout, [](uint64 a, uint64 b) { return a ^ b; });
+
+      uint64 acc = 0;
+      for(usize i = 0; i < n; i++) {
+        acc ^= i;
+        ok &= values[i] == acc;
+      }
+      REQUIRE(ok);
+
+      /// Blocks have to be folded in order, or this differs from seq.
+      std::vector<Affine> maps(n);
+      for(usize i = 0; i < n; i++) maps[i] = Affine{i * 2 + 3, i};
+      std::vector<Affine> expected(n);
+      std::vector<Affine> composed(n);
+      inclusive_scan(seq, Span<const Affine>(maps.data(), n), Span<Affine>(expected.data(), n), then);
+      inclusive_scan(par(sched, grain), Span<const Affine>(maps.data(), n), Span<Affine>(composed.data(), n), then);
+
+      for(usize i = 0; i < n; i++) ok &= composed[i].mul == expected[i].mul && composed[i].add == expected[i].add;
+      REQUIRE(ok);
+    }
+  }
+}
+
+TEST_CASE("Parallel policy without a scheduler runs inline", "[Core.ParallelAlgorithm]") {
+  uint32 values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  ParallelPolicy detached;
+  REQUIRE(reduce(detached, Span<uint32>(values), uint32(0)) == 36);
+  REQUIRE(count_if(detached, Span<uint32>(values), [](uint32 v) { return v > 4; }) == 4);
+
+  sort(detached, Span<uint32>(values), [](uint32 a, uint32 b) { return a > b; });
+  REQUIRE(values[0] == 8);
+  REQUIRE(values[7] == 1);
+}
@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Scheduler.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <vector>
+#include <deque>
+#include <atomic>
+
+using namespace kta;
+
+namespace {
+  using kta_tests::ArenaFixture;
+
+  struct CounterTask : Task {
+    std::atomic<int>* counter;
+
+    explicit CounterTask(std::atomic<int>* c) : Task(&run), counter(c) {}
+    static auto run(Task& self, TaskContext&) -> void {
+      static_cast<CounterTask&>(self).counter->fetch_add(1);
+    }
+  };
+
+  /// Plain fork/join fibonacci, to exercise nested spawn and wait.
+  struct FibTask : Task {
+    uint64 n;
+    uint64 result = 0;
+
+    explicit FibTask(uint64 num) : Task(&run), n(num) {}
+    static auto run(Task& self, TaskContext& ctx) -> void {
+      auto& task = static_cast<FibTask&>(self);
+      if(task.n < 2) {
+        task.result = task.n;
+        return;
+      }
+
+      FibTask left(task.n - 1), right(task.n - 2);
+      ctx.spawn(left);
+      FibTask::run(right, ctx);
+      ctx.wait(left);
+      task.result = left.result + right.result;
+    }
+  };
+}
+
+TEST_CASE_METHOD(ArenaFixture, "Scheduler start and stop", "[Core.Scheduler]") {
+  Scheduler sched;
+  REQUIRE_FALSE(sched.is_running());
+
+  REQUIRE(sched.start(&arena, {.workers = 3}).has_value());
+  REQUIRE(sched.is_running());
+  REQUIRE(sched.worker_count() == 3);
+  REQUIRE(sched.start(&arena, {}).error().code == ErrC::InvalidArg);
+
+  sched.stop();
+  REQUIRE_FALSE(sched.is_running());
+  REQUIRE(sched.worker_count() == 0);
+
+  Scheduler no_threads;
+  auto res = no_threads.start(&arena, {}, ThreadPlatform{});
+  REQUIRE(res.error().code == ErrC::NotImplemented);
+
+  Scheduler bad_capacity;
+  REQUIRE(bad_capacity.start(&arena, {.workers = 2, .deque_capacity = 100}).error().code == ErrC::InvalidArg);
+  REQUIRE_FALSE(bad_capacity.is_running());
+
+  /// A failed start leaves the scheduler as it was before.
+  REQUIRE(bad_capacity.start(&arena, {.workers = 2, .queue_capacity = 3}).error().code == ErrC::InvalidArg);
+  REQUIRE(bad_capacity.start(&arena, {.workers = 2}).has_value());
+  REQUIRE(bad_capacity.worker_count() == 2);
+  bad_capacity.stop();
+}
+
+TEST_CASE_METHOD(ArenaFixture, "Scheduler runs submitted tasks", "[Core.Scheduler]") {
+  Scheduler sched;
+  REQUIRE(sched.start(&arena, {.workers = 4, .queue_capacity = 16}).has_value());
+
+  std::atomic<int> counter{0};
+  std::deque<CounterTask> tasks;
+  for(int i = 0; i < 100; i++) tasks.emplace_back(&counter);
+
+  /// More tasks than the injection queue holds: the rest run inline.
+  for(auto& task : tasks) sched.submit(task);
+  for(auto& task : tasks) sched.wait(task);
+
+  REQUIRE(counter.load() == 100);
+  for(auto& task : tasks) REQUIRE(task.is_done());
+}
+
+TEST_CASE_METHOD(ArenaFixture, "Scheduler nested fork/join", "[Core.Scheduler]") {
+  Scheduler sched;
+  REQUIRE(sched.start(&arena, {.workers = 4, .deque_capacity = 64}).has_value());
+
+  FibTask root(24);
+  sched.submit(root);
+  sched.wait(root);
+  REQUIRE(root.result == 46368);
+
+  /// Tiny deques overflow all the time; tasks then run inline.
+  Scheduler small;
+  REQUIRE(small.start(&arena, {.workers = 2, .deque_capacity = 2}).has_value());
+  FibTask other(20);
+  small.submit(other);
+  small.wait(other);
+  REQUIRE(other.result == 6765);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "Scheduler parallel_for", "[Core.Scheduler]") {
+  Scheduler sched;
+  REQUIRE(sched.start(&arena, {.workers = 4}).has_value());
+
+  std::vector<uint64> values(100'000);
+  for(usize i = 0; i < values.size(); i++) values[i] = i;
+  Span<uint64> span(values.data(), values.size());
+
+  for(usize grain : {usize(0), usize(1), usize(7), usize(1000), usize(1'000'000)}) {
+    parallel_for(sched, span, [](uint64& v) { v += 1; }, grain);
+  }
+
+  bool all_bumped = true;
+  for(usize i = 0; i < values.size(); i++) all_bumped &= values[i] == i + 5;
+  REQUIRE(all_bumped);
+
+  std::atomic<uint64> sum{0};
+  std::atomic<usize> largest{0};
+  parallel_for_chunks(sched, span, [&](Span<uint64> chunk) {
+    uint64 local = 0;
+    for(uint64 v : chunk) local += v;
+    sum.fetch_add(local);
+
+    usize seen = largest.load();
+    while(chunk.size() > seen && !largest.compare_exchange_weak(seen, chunk.size())) {}
+  }, 512);
+
+  const uint64 n = values.size();
+  REQUIRE(sum.load() == n * (n - 1) / 2 + 5 * n);
+  REQUIRE(largest.load() <= 512);
+
+  Span<uint64> empty;
+  parallel_for(sched, empty, [](uint64&) { FAIL("called on an empty range"); });
+  REQUIRE(default_grain_size(sched, 0) == 1);
+  REQUIRE(default_grain_size(sched, 4000) == 100);
+}
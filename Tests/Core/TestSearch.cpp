@@ -0,0 +1,84 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Search.hpp>
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+using namespace kta;
+
+TEST_CASE("Eytzinger layout matches lower_bound", "[Core.Search]") {
+  for(usize n : {usize(0), usize(1), usize(2), usize(3), usize(7), usize(8), usize(100), usize(4097)}) {
+    std::vector<uint32> sorted(n);
+    for(usize i = 0; i < n; i++) sorted[i] = static_cast<uint32>(i * 3 + 10);
+
+    std::vector<uint32> layout(n + 1, 0);
+    eytzinger_build(Span<const uint32>(sorted.data(), n), Span<uint32>(layout.data(), layout.size()));
+    Span<const uint32> tree(layout.data(), layout.size());
+
+    for(uint32 probe = 0; probe < n * 3 + 15; probe++) {
+      const usize expected = lower_bound(Span<const uint32>(sorted.data(), n), probe);
+      const usize k = eytzinger_lower_bound(tree, probe);
+      if(expected == n) {
+        REQUIRE(k == 0);
+      } else {
+        REQUIRE(k != 0);
+        REQUIRE(layout[k] == sorted[expected]);
+      }
+      REQUIRE(eytzinger_contains(tree, probe) == (probe >= 10 && (probe - 10) % 3 == 0 && probe < n * 3 + 10));
+    }
+  }
+}
+
+TEST_CASE("Eytzinger layout of records", "[Core.Search]") {
+  struct Entry {
+    uint64 key;
+    uint32 payload;
+  };
+
+  std::vector<Entry> sorted;
+  for(uint32 i = 0; i < 50; i++) sorted.push_back(Entry{uint64(i) * 10, i});
+  std::vector<Entry> layout(sorted.size() + 1);
+  eytzinger_build(Span<const Entry>(sorted.data(), sorted.size()), Span<Entry>(layout.data(), layout.size()));
+
+  auto by_key = [](const Entry& e, uint64 key) { return e.key < key; };
+  const usize k = eytzinger_lower_bound(Span<const Entry>(layout.data(), layout.size()), uint64(205), by_key);
+  REQUIRE(k != 0);
+  REQUIRE(layout[k].payload == 21);
+}
+
+TEST_CASE("linear_lower_bound counts smaller keys", "[Core.Search]") {
+  std::mt19937_64 rng(3);
+
+  auto check = [&](auto sample) {
+    using T = decltype(sample);
+    for(usize n : {usize(0), usize(1), usize(7), usize(16), usize(33), usize(64), usize(200)}) {
+      std::vector<T> keys(n);
+      for(auto& key : keys) key = static_cast<T>(rng());
+      std::sort(keys.begin(), keys.end());
+
+      for(int round = 0; round < 50; round++) {
+        const T probe = round % 3 == 0 && n != 0 ? keys[rng() % n] : static_cast<T>(rng());
+        const auto expected = static_cast<usize>(std::lower_bound(keys.begin(), keys.end(), probe) - keys.begin());
+        REQUIRE(linear_lower_bound(Span<const T>(keys.data(), n), probe) == expected);
+      }
+    }
+  };
+
+  check(int32{});
+  check(uint32{});
+  check(int64{});
+  check(uint64{});
+  check(int16{});
+
+  const uint32 edge[] = {0, 1, 0x7FFF'FFFF, 0x8000'0000, 0xFFFF'FFFF, 0xFFFF'FFFF, 0xFFFF'FFFF, 0xFFFF'FFFF, 0xFFFF'FFFF};
+  REQUIRE(linear_lower_bound(Span<const uint32>(edge), 0x8000'0000u) == 3);
+  REQUIRE(linear_lower_bound(Span<const uint32>(edge), 0xFFFF'FFFFu) == 4);
+  REQUIRE(linear_lower_bound(Span<const uint32>(edge), 0u) == 0);
+}
@@ -0,0 +1,87 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/SeqLock.hpp>
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+using namespace kta;
+
+namespace {
+  /// Odd size on purpose, so the last word is only partially used.
+  struct Snapshot {
+    uint64 version;
+    uint64 doubled;
+    uint32 tag;
+    uint8 flag;
+  };
+}
+
+TEST_CASE("SeqLock load and store", "[Core.SeqLock]") {
+  SeqLock<Snapshot> lock(Snapshot{1, 2, 3, 1});
+  REQUIRE(lock.sequence() == 0);
+  REQUIRE(lock.load().tag == 3);
+
+  lock.store(Snapshot{5, 10, 7, 0});
+  REQUIRE(lock.sequence() == 2);
+
+  Snapshot out{};
+  REQUIRE(lock.try_load(out));
+  REQUIRE(out.version == 5);
+  REQUIRE(out.doubled == 10);
+  REQUIRE(out.tag == 7);
+
+  lock.update([](Snapshot& s) { s.version++; s.doubled = s.version * 2; });
+  REQUIRE(lock.load().doubled == 12);
+  REQUIRE(lock.sequence() == 4);
+}
+
+TEST_CASE("SeqLock readers never see torn values", "[Core.SeqLock]") {
+  SeqLock<Snapshot> lock(Snapshot{0, 0, 0, 0});
+  std::atomic<bool> done{false};
+  std::atomic<bool> torn{false};
+  std::vector<std::thread> threads;
+
+  for(int w = 0; w < 2; w++) {
+    threads.emplace_back([&] {
+      for(int i = 0; i < 20'000; i++) {
+        lock.update([](Snapshot& s) {
+          s.version++;
+          s.doubled = s.version * 2;
+          s.tag     = static_cast<uint32>(s.version ^ 0xABCD);
+          s.flag    = static_cast<uint8>(s.version & 1);
+        });
+      }
+    });
+  }
+
+  for(int r = 0; r < 2; r++) {
+    threads.emplace_back([&] {
+      uint64 last = 0;
+      while(!done.load()) {
+        const Snapshot s = lock.load();
+        const bool consistent = s.doubled == s.version * 2
+          && s.tag == static_cast<uint32>(s.version ^ 0xABCD)
+          && s.flag == static_cast<uint8>(s.version & 1)
+          && s.version >= last;
+        if(!consistent) torn.store(true);
+        last = s.version;
+      }
+    });
+  }
+
+  threads[0].join();
+  threads[1].join();
+  done.store(true);
+  for(usize i = 2; i < threads.size(); i++) threads[i].join();
+
+  REQUIRE_FALSE(torn.load());
+  REQUIRE(lock.load().version == 40'000);
+  REQUIRE(lock.sequence() == 80'000);
+}
@@ -0,0 +1,197 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/SmallVector.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <string>
+#include <utility>
+
+using namespace kta;
+
+namespace {
+  struct Tracked {
+    static inline int live = 0;
+    static inline int moves = 0;
+    static inline int copies = 0;
+
+    int value = 0;
+
+    Tracked(int v) : value(v) { ++live; }
+    Tracked(const Tracked& o) : value(o.value) { ++live; ++copies; }
+    Tracked(Tracked&& o) noexcept : value(o.value) { ++live; ++moves; }
+    ~Tracked() { --live; }
+
+    static void reset() { live = 0; moves = 0; copies = 0; }
+  };
+
+  using kta_tests::ArenaFixture;
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector stays inline up to N", "[Core.SmallVector]") {
+  SmallVector<int, 8> vec(&arena);
+  REQUIRE(vec.empty());
+  REQUIRE(vec.capacity() == 8);
+
+  for(int i = 0; i < 8; i++) vec.push_back(i);
+  REQUIRE(vec.size() == 8);
+  REQUIRE(vec.is_inline());
+  REQUIRE(arena.cur() == arena.beg());
+
+  for(usize i = 0; i < vec.size(); i++) REQUIRE(vec[i] == static_cast<int>(i));
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector spills to the allocator", "[Core.SmallVector]") {
+  SmallVector<int, 4> vec(&arena);
+  for(int i = 0; i < 100; i++) vec.emplace_back(i * 3);
+
+  REQUIRE(vec.size() == 100);
+  REQUIRE_FALSE(vec.is_inline());
+  REQUIRE(vec.capacity() >= 100);
+  REQUIRE(arena.is_within_range(vec.data()));
+
+  int expected = 0;
+  for(int v : vec) {
+    REQUIRE(v == expected);
+    expected += 3;
+  }
+
+  REQUIRE(vec.front() == 0);
+  REQUIRE(vec.back() == 99 * 3);
+}
+
+TEST_CASE("SmallVector without an allocator cannot grow", "[Core.SmallVector]") {
+  SmallVector<int, 2> vec;
+  REQUIRE(vec.try_emplace_back(1).has_value());
+  REQUIRE(vec.try_emplace_back(2).has_value());
+
+  auto res = vec.try_emplace_back(3);
+  REQUIRE_FALSE(res.has_value());
+  REQUIRE(res.error().code == ErrC::NoMemory);
+  REQUIRE(vec.size() == 2);
+  REQUIRE_FALSE(vec.reserve(16).has_value());
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector emplace_back does not move the new element", "[Core.SmallVector]") {
+  Tracked::reset();
+  {
+    SmallVector<Tracked, 2> vec(&arena);
+    vec.emplace_back(1);
+    vec.emplace_back(2);
+    REQUIRE(Tracked::moves == 0);
+    REQUIRE(Tracked::copies == 0);
+
+    /// Growing relocates the two existing elements, nothing else.
+    vec.emplace_back(3);
+    REQUIRE(Tracked::moves == 2);
+    REQUIRE(Tracked::copies == 0);
+    REQUIRE(Tracked::live == 3);
+  }
+
+  REQUIRE(Tracked::live == 0);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector push_back of its own element while growing", "[Core.SmallVector]") {
+  SmallVector<std::string, 2> vec(&arena);
+  vec.push_back("first element, long enough to live on the heap");
+  vec.push_back("second");
+
+  vec.push_back(vec[0]);
+  REQUIRE(vec.size() == 3);
+  REQUIRE(vec[2] == vec[0]);
+  REQUIRE(vec[2] == "first element, long enough to live on the heap");
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector reserve, resize and pop_back", "[Core.SmallVector]") {
+  SmallVector<int, 4> vec(&arena);
+
+  REQUIRE(vec.reserve(32).has_value());
+  REQUIRE(vec.capacity() == 32);
+  REQUIRE_FALSE(vec.is_inline());
+
+  REQUIRE(vec.resize(10).has_value());
+  REQUIRE(vec.size() == 10);
+  for(int v : vec) REQUIRE(v == 0);
+
+  vec[9] = 42;
+  REQUIRE(vec.back() == 42);
+  vec.pop_back();
+  REQUIRE(vec.size() == 9);
+  REQUIRE(vec.back() == 0);
+
+  REQUIRE(vec.resize(3).has_value());
+  REQUIRE(vec.size() == 3);
+  REQUIRE(vec.capacity() == 32);
+
+  vec.clear();
+  REQUIRE(vec.empty());
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector move semantics", "[Core.SmallVector]") {
+  SECTION("Moving an inline vector relocates its elements") {
+    SmallVector<std::string, 4> a(&arena);
+    a.push_back("one");
+    a.push_back("two");
+
+    SmallVector<std::string, 4> b(std::move(a));
+    REQUIRE(a.empty());
+    REQUIRE(b.size() == 2);
+    REQUIRE(b.is_inline());
+    REQUIRE(b[0] == "one");
+    REQUIRE(b[1] == "two");
+  }
+
+  SECTION("Moving a spilled vector steals its buffer") {
+    SmallVector<int, 2> a(&arena);
+    for(int i = 0; i < 10; i++) a.push_back(i);
+    const int* buffer = a.data();
+
+    SmallVector<int, 2> b(&arena);
+    b = std::move(a);
+    REQUIRE(b.data() == buffer);
+    REQUIRE(b.size() == 10);
+    REQUIRE(a.empty());
+    REQUIRE(a.is_inline());
+    REQUIRE(a.capacity() == 2);
+  }
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector span view", "[Core.SmallVector]") {
+  SmallVector<int, 4> vec(&arena);
+  for(int i = 0; i < 6; i++) vec.push_back(i);
+
+  Span<int> span = vec.span();
+  REQUIRE(span.size() == 6);
+  REQUIRE(span.data() == vec.data());
+  REQUIRE(span[5] == 5);
+}
+
+TEST_CASE_METHOD(ArenaFixture, "SmallVector grows in place at the top of a BumpAllocator", "[Core.SmallVector]") {
+  SmallVector<int, 2> vec(&arena);
+  for(int i = 0; i < 4; i++) vec.push_back(i);
+  const int* first = vec.data();
+  REQUIRE(vec.capacity() == 4);
+
+  SECTION("Nothing allocated after it") {
+    for(int i = 4; i < 64; i++) vec.push_back(i);
+    REQUIRE(vec.data() == first);
+    REQUIRE(vec.capacity() == 64);
+    REQUIRE(arena.cur() == static_cast<const void*>(first + 64));
+
+    REQUIRE(vec.reserve(200).has_value());
+    REQUIRE(vec.data() == first);
+    for(int i = 0; i < 64; i++) REQUIRE(vec[i] == i);
+  }
+
+  SECTION("Something allocated after it") {
+    REQUIRE(arena.allocate_bytes(8, 8) != nullptr);
+    vec.push_back(4);
+    REQUIRE(vec.data() != first);
+    for(int i = 0; i < 5; i++) REQUIRE(vec[i] == i);
+  }
+}
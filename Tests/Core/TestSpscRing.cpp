@@ -0,0 +1,127 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/SpscRing.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace kta;
+
+TEST_CASE("Atomic basic operations", "[Core.Atomic]") {
+  Atomic<uint32> value(5);
+  REQUIRE(value.load() == 5);
+  REQUIRE(value.fetch_add(3) == 5);
+  REQUIRE(value.fetch_sub(1) == 8);
+  REQUIRE(value.exchange(100) == 7);
+
+  uint32 expected = 1;
+  REQUIRE_FALSE(value.compare_exchange_strong(expected, 2));
+  REQUIRE(expected == 100);
+  REQUIRE(value.compare_exchange_strong(expected, 2));
+  REQUIRE(value.load(MemoryOrder::Relaxed) == 2);
+
+  Atomic<int*> ptr;
+  int x = 0;
+  ptr.store(&x, MemoryOrder::Release);
+  REQUIRE(ptr.load(MemoryOrder::Acquire) == &x);
+}
+
+TEST_CASE("SpscRing push and pop", "[Core.SpscRing]") {
+  SpscRing<int, 8> ring;
+  REQUIRE(ring.empty_approx());
+  REQUIRE_FALSE(ring.try_pop().has_value());
+
+  for(int i = 0; i < 8; i++) REQUIRE(ring.try_push(i));
+  REQUIRE_FALSE(ring.try_push(8));
+  REQUIRE(ring.size_approx() == 8);
+
+  for(int i = 0; i < 8; i++) {
+    auto value = ring.try_pop();
+    REQUIRE(value.has_value());
+    REQUIRE(value.value() == i);
+  }
+
+  REQUIRE_FALSE(ring.try_pop().has_value());
+
+  /// Indices keep growing past the capacity and wrap around the storage.
+  for(int round = 0; round < 100; round++) {
+    REQUIRE(ring.try_push(round));
+    REQUIRE(ring.try_pop().value() == round);
+  }
+}
+
+TEST_CASE("SpscRing batches", "[Core.SpscRing]") {
+  SpscRing<int, 16> ring;
+  int in[20];
+  for(int i = 0; i < 20; i++) in[i] = i;
+
+  REQUIRE(ring.push_batch(Span<const int>(in, 10)) == 10);
+  REQUIRE(ring.push_batch(Span<const int>(in + 10, 10)) == 6);
+  REQUIRE(ring.push_batch(Span<const int>(in, 1)) == 0);
+
+  int out[20]{};
+  REQUIRE(ring.pop_batch(Span<int>(out, 4)) == 4);
+  REQUIRE(ring.pop_batch(Span<int>(out + 4, 20)) == 12);
+  for(int i = 0; i < 16; i++) REQUIRE(out[i] == i);
+  REQUIRE(ring.pop_batch(Span<int>(out, 20)) == 0);
+}
+
+TEST_CASE("SpscRing destroys remaining elements", "[Core.SpscRing]") {
+  auto tracker = std::make_shared<int>(0);
+  {
+    SpscRing<std::shared_ptr<int>, 4> ring;
+    REQUIRE(ring.try_push(tracker));
+    REQUIRE(ring.try_push(tracker));
+    REQUIRE(ring.try_push(tracker));
+    REQUIRE(tracker.use_count() == 4);
+
+    REQUIRE(ring.try_pop().has_value());
+    REQUIRE(tracker.use_count() == 3);
+  }
+
+  REQUIRE(tracker.use_count() == 1);
+}
+
+TEST_CASE("SpscRing across two threads", "[Core.SpscRing]") {
+  constexpr uint64 count = 1'000'000;
+  SpscRing<uint64, 1024> ring;
+
+  std::thread producer([&] {
+    uint64 batch[16];
+    uint64 next = 0;
+    while(next < count) {
+      if(next % 3 == 0) {
+        if(ring.try_push(next)) ++next;
+        continue;
+      }
+
+      const usize n = count - next < 16 ? static_cast<usize>(count - next) : 16;
+      for(usize i = 0; i < n; i++) batch[i] = next + i;
+      next += ring.push_batch(Span<const uint64>(batch, n));
+    }
+  });
+
+  uint64 expected = 0;
+  uint64 sum = 0;
+  bool in_order = true;
+  uint64 batch[32];
+
+  while(expected < count) {
+    const usize n = ring.pop_batch(Span<uint64>(batch, 32));
+    for(usize i = 0; i < n; i++) {
+      in_order &= batch[i] == expected++;
+      sum += batch[i];
+    }
+  }
+
+  producer.join();
+  REQUIRE(in_order);
+  REQUIRE(sum == count * (count - 1) / 2);
+  REQUIRE(ring.empty_approx());
+}
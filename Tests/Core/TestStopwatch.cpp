@@ -0,0 +1,73 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Stopwatch.hpp>
+
+#include <time.h>
+
+using namespace kta;
+
+namespace {
+  auto now_ns() -> uint64 {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64>(ts.tv_sec) * 1'000'000'000 + static_cast<uint64>(ts.tv_nsec);
+  }
+
+  auto spin_for_ns(uint64 duration) -> void {
+    const uint64 begin = now_ns();
+    while(now_ns() - begin < duration) {}
+  }
+}
+
+TEST_CASE("Cycle counter", "[Core.Stopwatch]") {
+  const uint64 a = read_cycle_counter();
+  const uint64 b = read_cycle_counter();
+  REQUIRE(b >= a);
+  REQUIRE(cycle_counter_frequency() != 0);
+  REQUIRE(cycles_to_ns(0) == 0);
+  REQUIRE(cycles_to_ns(cycle_counter_frequency()) > 999'000'000);
+  REQUIRE(cycles_to_ns(cycle_counter_frequency()) <= 1'000'000'000);
+}
+
+TEST_CASE("Stopwatch measures elapsed time", "[Core.Stopwatch]") {
+  Stopwatch watch;
+  spin_for_ns(20'000'000);
+  const uint64 elapsed = watch.elapsed_ns();
+  REQUIRE(elapsed >= 19'000'000);
+  REQUIRE(elapsed < 1'000'000'000);
+  REQUIRE(watch.elapsed_cycles() >= 1);
+
+  const uint64 lap = watch.lap_ns();
+  REQUIRE(lap >= elapsed);
+  REQUIRE(watch.elapsed_ns() < lap);
+
+  watch.restart();
+  REQUIRE(watch.elapsed_ns() < 19'000'000);
+}
+
+TEST_CASE("Cycle counter frequency override", "[Core.Stopwatch]") {
+  const uint64 detected = cycle_counter_frequency();
+
+  set_cycle_counter_frequency(1'000'000'000);
+  REQUIRE(cycles_to_ns(12345) == 12345);
+
+  set_cycle_counter_frequency(2'000'000'000);
+  REQUIRE(cycles_to_ns(1'000'000) == 500'000);
+  REQUIRE(cycle_counter_frequency() == 2'000'000'000);
+
+  /// A day's worth of cycles at 4 GHz doesn't overflow.
+  set_cycle_counter_frequency(4'000'000'000);
+  const uint64 day_ns = 86'400ull * 1'000'000'000;
+  REQUIRE(cycles_to_ns(86'400ull * 4'000'000'000) / 1'000'000 == day_ns / 1'000'000);
+
+  set_cycle_counter_frequency(0);
+  REQUIRE(cycles_to_ns(1'000'000) == 0);
+
+  set_cycle_counter_frequency(detected);
+  REQUIRE(cycle_counter_frequency() == detected);
+}
@@ -0,0 +1,174 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#define KTA_TRACING_ON_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Trace.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kta;
+
+namespace {
+  std::string captured;
+
+  auto capture_handler(StringView buf) -> void {
+    captured.append(buf.data(), buf.size());
+  }
+
+  auto count_of(const std::string& haystack, const std::string& needle) -> usize {
+    usize count = 0;
+    for(usize pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) {
+      count++;
+    }
+    return count;
+  }
+
+  NOINLINE_ auto traced_leaf() -> void {
+    KTA_TRACE_SCOPE("leaf");
+  }
+}
+
+TEST_CASE("Zones record into the thread's buffer", "[Core.Trace]") {
+  TraceEvent storage[16];
+  TraceBuffer buffer(Span<TraceEvent>(storage, 16));
+
+  SECTION("Nothing is recorded without a buffer") {
+    traced_leaf();
+    REQUIRE(trace_thread_buffer() == nullptr);
+    REQUIRE(buffer.events().empty());
+  }
+
+  SECTION("Nested zones") {
+    trace_attach_thread(buffer);
+    REQUIRE(trace_thread_buffer() == &buffer);
+    {
+      KTA_TRACE_SCOPE("outer");
+      traced_leaf();
+      traced_leaf();
+    }
+
+    const auto events = buffer.events();
+    REQUIRE(events.size() == 3);
+    REQUIRE(StringView(events[0].name) == StringView("leaf"));
+    REQUIRE(StringView(events[1].name) == StringView("leaf"));
+    REQUIRE(StringView(events[2].name) == StringView("outer"));
+    for(const TraceEvent& event : events) REQUIRE(event.end >= event.begin);
+
+    /// Zones end in the order they close, and the outer one spans both leaves.
+    REQUIRE(events[0].end <= events[1].begin);
+    REQUIRE(events[2].begin <= events[0].begin);
+    REQUIRE(events[2].end >= events[1].end);
+
+    trace_detach_thread();
+    traced_leaf();
+    REQUIRE(buffer.events().size() == 3);
+    trace_detach_buffer(buffer);
+  }
+
+  SECTION("A full buffer drops and counts") {
+    trace_attach_thread(buffer);
+    for(usize i = 0; i < 20; i++) traced_leaf();
+    REQUIRE(buffer.events().size() == 16);
+    REQUIRE(buffer.dropped() == 4);
+
+    buffer.clear();
+    REQUIRE(buffer.events().empty());
+    REQUIRE(buffer.dropped() == 0);
+    traced_leaf();
+    REQUIRE(buffer.events().size() == 1);
+    trace_detach_buffer(buffer);
+    REQUIRE(trace_thread_buffer() == nullptr);
+  }
+}
+
+TEST_CASE("A buffer destroyed while attached leaves the export", "[Core.Trace]") {
+  OStream<> stream(capture_handler);
+  captured.clear();
+  {
+    TraceEvent storage[4];
+    TraceBuffer buffer(Span<TraceEvent>(storage, 4));
+    trace_attach_thread(buffer);
+    traced_leaf();
+  }
+
+  REQUIRE(trace_thread_buffer() == nullptr);
+  REQUIRE(write_chrome_trace(stream) == 0);
+}
+
+TEST_CASE("Chrome trace export", "[Core.Trace]") {
+  OStream<> stream(capture_handler);
+  captured.clear();
+
+  SECTION("Empty") {
+    REQUIRE(write_chrome_trace(stream) == 0);
+    REQUIRE(captured == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n],\"otherData\":{\"dropped_events\":0}}\n");
+  }
+
+  SECTION("Events, thread names and escaping") {
+    TraceEvent storage[8];
+    TraceBuffer buffer(Span<TraceEvent>(storage, 8), "main \"thread\"");
+    trace_attach_thread(buffer);
+
+    const uint64 base = read_cycle_counter();
+    const uint64 freq = cycle_counter_frequency();
+    buffer.record("first", base, base + freq / 1000);               /// 1ms long.
+    buffer.record("tab\there", base + freq / 1000, base + freq / 1000);
+
+    REQUIRE(write_chrome_trace(stream) == 2);
+    REQUIRE(captured.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    REQUIRE(captured.ends_with("],\"otherData\":{\"dropped_events\":0}}\n"));
+
+    const std::string tid = std::to_string(buffer.thread_id());
+    REQUIRE(captured.find("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid
+                          + ",\"args\":{\"name\":\"main \\\"thread\\\"\"}}") != std::string::npos);
+    REQUIRE(captured.find("{\"name\":\"first\",\"ph\":\"X\",\"ts\":0.000,\"dur\":") != std::string::npos);
+    REQUIRE(captured.find("{\"name\":\"tab\\u0009here\",\"ph\":\"X\",\"ts\":") != std::string::npos);
+    REQUIRE(captured.find(",\"dur\":0.000,\"pid\":1,\"tid\":" + tid + "}") != std::string::npos);
+
+    /// 1ms, give or take the rounding of the cycle conversion.
+    const usize dur = captured.find("\"dur\":") + 6;
+    const double first_dur = std::stod(captured.substr(dur, captured.find(',', dur) - dur));
+    REQUIRE(first_dur > 999.0);
+    REQUIRE(first_dur <= 1000.0);
+
+    trace_detach_buffer(buffer);
+  }
+
+  SECTION("Every thread's buffer, and the dropped total") {
+    constexpr usize thread_count = 4;
+    std::vector<TraceEvent> storage(thread_count * 64);
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;
+    for(usize i = 0; i < thread_count; i++) {
+      buffers.push_back(std::make_unique<TraceBuffer>(Span<TraceEvent>(storage.data() + i * 64, 64)));
+    }
+
+    std::vector<std::thread> threads;
+    for(usize i = 0; i < thread_count; i++) {
+      threads.emplace_back([&buffers, i] {
+        trace_attach_thread(*buffers[i]);
+        for(usize n = 0; n < 64 + i; n++) traced_leaf();
+        trace_detach_thread();
+      });
+    }
+    for(auto& thread : threads) thread.join();
+
+    REQUIRE(write_chrome_trace(stream) == thread_count * 64);
+    REQUIRE(count_of(captured, "\"name\":\"leaf\"") == thread_count * 64);
+    REQUIRE(captured.find("\"dropped_events\":6}") != std::string::npos);
+
+    for(auto& buffer : buffers) {
+      REQUIRE(count_of(captured, ",\"tid\":" + std::to_string(buffer->thread_id()) + "}") == 64);
+      trace_detach_buffer(*buffer);
+    }
+
+    captured.clear();
+    REQUIRE(write_chrome_trace(stream) == 0);
+  }
+}
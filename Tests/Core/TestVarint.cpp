@@ -0,0 +1,173 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/Varint.hpp>
+#include <Kalantha/Core/Limits.hpp>
+
+#include <vector>
+
+using namespace kta;
+
+namespace {
+  /// Values of every encoded length, with a bias towards small ones.
+  auto make_values(usize count, uint32 max_bits) -> std::vector<uint64> {
+    std::vector<uint64> values(count);
+    uint64 state = 0x2545F4914F6CDD1DULL;
+    for(auto& value : values) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      const uint32 bits = static_cast<uint32>(state % (max_bits + 1));
+      value = bits == 64 ? state : state & ((1ULL << bits) - 1);
+      if(state % 3 == 0) value &= 0x7F;
+    }
+    return values;
+  }
+}
+
+TEST_CASE("Zigzag encoding", "[Core.Varint]") {
+  STATIC_REQUIRE(zigzag_encode(int32(0)) == 0);
+  STATIC_REQUIRE(zigzag_encode(int32(-1)) == 1);
+  STATIC_REQUIRE(zigzag_encode(int32(1)) == 2);
+  STATIC_REQUIRE(zigzag_encode(int32(-2)) == 3);
+  STATIC_REQUIRE(zigzag_encode(NumericLimits<int32>::max()) == 0xFFFFFFFEu);
+  STATIC_REQUIRE(zigzag_encode(NumericLimits<int32>::min()) == 0xFFFFFFFFu);
+  STATIC_REQUIRE(zigzag_encode(int64(-3)) == 5);
+
+  for(int64 v : {int64(0), int64(1), int64(-1), int64(123456789), int64(-987654321),
+                 NumericLimits<int64>::max(), NumericLimits<int64>::min()}) {
+    REQUIRE(zigzag_decode(zigzag_encode(v)) == v);
+    REQUIRE(zigzag_decode(zigzag_encode(static_cast<int32>(v))) == static_cast<int32>(v));
+  }
+}
+
+TEST_CASE("Varint single values", "[Core.Varint]") {
+  STATIC_REQUIRE(varint_size(0) == 1);
+  STATIC_REQUIRE(varint_size(127) == 1);
+  STATIC_REQUIRE(varint_size(128) == 2);
+  STATIC_REQUIRE(varint_size(~0ull) == 10);
+  STATIC_REQUIRE(max_varint_size<uint32> == 5);
+
+  uint8 buffer[10]{};
+  REQUIRE(encode_varint(uint32(300), Span<uint8>(buffer)).value() == 2);
+  REQUIRE(buffer[0] == 0xAC);
+  REQUIRE(buffer[1] == 0x02);
+
+  uint32 small = 0;
+  REQUIRE(decode_varint(Span<const uint8>(buffer, 2), small).value() == 2);
+  REQUIRE(small == 300);
+
+  for(uint64 v : {0ull, 1ull, 127ull, 128ull, 16383ull, 16384ull, 0xFFFFFFFFull, ~0ull}) {
+    const usize len = encode_varint(v, Span<uint8>(buffer)).value();
+    REQUIRE(len == varint_size(v));
+    uint64 back = 0;
+    REQUIRE(decode_varint(Span<const uint8>(buffer, len), back).value() == len);
+    REQUIRE(back == v);
+
+    /// One byte short.
+    REQUIRE(decode_varint(Span<const uint8>(buffer, len - 1), back).error().code == ErrC::Underflow);
+    REQUIRE(encode_varint(v, Span<uint8>(buffer, len - 1)).error().code == ErrC::Overflow);
+  }
+}
+
+TEST_CASE("Varint rejects malformed input", "[Core.Varint]") {
+  /// 2^32 doesn't fit in a uint32.
+  const uint8 too_big[] = {0x80, 0x80, 0x80, 0x80, 0x10};
+  uint32 value32 = 0;
+  REQUIRE(decode_varint(Span<const uint8>(too_big), value32).error().code == ErrC::InvalidArg);
+
+  uint64 value64 = 0;
+  REQUIRE(decode_varint(Span<const uint8>(too_big), value64).value() == 5);
+  REQUIRE(value64 == (1ull << 32));
+
+  /// Continuation bit on the last byte a uint32 may use.
+  const uint8 too_long[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+  REQUIRE(decode_varint(Span<const uint8>(too_long), value32).error().code == ErrC::InvalidArg);
+
+  const uint8 max64[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+  REQUIRE(decode_varint(Span<const uint8>(max64), value64).value() == 10);
+  REQUIRE(value64 == ~0ull);
+
+  const uint8 over64[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+  REQUIRE(decode_varint(Span<const uint8>(over64), value64).error().code == ErrC::InvalidArg);
+  REQUIRE(decode_varint(Span<const uint8>{}, value64).error().code == ErrC::Underflow);
+}
+
+TEST_CASE("Varint bulk roundtrip", "[Core.Varint]") {
+  for(usize count : {0, 1, 7, 8, 9, 100, 1000}) {
+    const auto wide = make_values(count, 64);
+    std::vector<uint8> encoded(count * max_varint_size<uint64>);
+    const usize size = encode_varints(Span<const uint64>(wide.data(), wide.size()),
+                                      Span<uint8>(encoded.data(), encoded.size())).value();
+
+    std::vector<uint64> decoded(count);
+    REQUIRE(decode_varints(Span<const uint8>(encoded.data(), size), Span<uint64>(decoded.data(), count)).value() == size);
+    REQUIRE(decoded == wide);
+
+    if(count > 0) {
+      REQUIRE(decode_varints(Span<const uint8>(encoded.data(), size - 1), Span<uint64>(decoded.data(), count))
+        .error().code == ErrC::Underflow);
+      REQUIRE(encode_varints(Span<const uint64>(wide.data(), wide.size()), Span<uint8>(encoded.data(), size - 1))
+        .error().code == ErrC::Overflow);
+    }
+  }
+
+  /// Long runs of one byte values take the eight-at-a-time path.
+  std::vector<uint32> small(203);
+  for(usize i = 0; i < small.size(); i++) small[i] = i % 50 == 49 ? 100000 : static_cast<uint32>(i % 128);
+  std::vector<uint8> encoded(small.size() * max_varint_size<uint32>);
+  const usize size = encode_varints(Span<uint32>(small.data(), small.size()),
+                                    Span<uint8>(encoded.data(), encoded.size())).value();
+  REQUIRE(size == 203 + 4 * 2);
+
+  std::vector<uint32> decoded(small.size());
+  REQUIRE(decode_varints(Span<const uint8>(encoded.data(), size), Span<uint32>(decoded.data(), decoded.size())).value() == size);
+  REQUIRE(decoded == small);
+}
+
+TEST_CASE("Stream VByte roundtrip", "[Core.Varint]") {
+  for(usize count : {0, 1, 3, 4, 5, 15, 16, 17, 64, 1001}) {
+    const auto wide = make_values(count, 32);
+    std::vector<uint32> values(wide.begin(), wide.end());
+
+    std::vector<uint8> encoded(streamvbyte_max_size(count));
+    const usize size = streamvbyte_encode(Span<const uint32>(values.data(), count),
+                                          Span<uint8>(encoded.data(), encoded.size())).value();
+    REQUIRE(size <= streamvbyte_max_size(count));
+
+    std::vector<uint32> decoded(count, 0xDEADBEEF);
+    REQUIRE(streamvbyte_decode(Span<const uint8>(encoded.data(), size), Span<uint32>(decoded.data(), count)).value() == size);
+    REQUIRE(decoded == values);
+
+    /// The scalar decoder agrees with whichever one was dispatched to.
+    std::vector<uint32> scalar(count);
+    const usize ctrl_size = (count + 3) / 4;
+    REQUIRE(detail_::svb_decode_scalar_(encoded.data(), encoded.data() + ctrl_size, encoded.data() + size,
+                                        scalar.data(), 0, count) == encoded.data() + size);
+    REQUIRE(scalar == values);
+
+    if(count > 0) {
+      REQUIRE(streamvbyte_decode(Span<const uint8>(encoded.data(), size - 1), Span<uint32>(decoded.data(), count))
+        .error().code == ErrC::Underflow);
+      REQUIRE(streamvbyte_encode(Span<const uint32>(values.data(), count), Span<uint8>(encoded.data(), size - 1))
+        .error().code == ErrC::Overflow);
+    }
+  }
+}
+
+TEST_CASE("Stream VByte layout", "[Core.Varint]") {
+  const uint32 values[] = {1, 0x100, 0x10000, 0x1000000, 5};
+  uint8 encoded[streamvbyte_max_size(5)]{};
+  REQUIRE(streamvbyte_encode(Span<const uint32>(values), Span<uint8>(encoded)).value() == 2 + 1 + 2 + 3 + 4 + 1);
+
+  REQUIRE(encoded[0] == 0b11'10'01'00);
+  REQUIRE(encoded[1] == 0);
+  REQUIRE(encoded[2] == 1);
+  REQUIRE(encoded[3] == 0x00);
+  REQUIRE(encoded[4] == 0x01);
+  REQUIRE(encoded[12] == 5);
+}
@@ -0,0 +1,104 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#define KTA_ASSUME_TESTING_ENV_
+#include <catch2/catch_test_macros.hpp>
+#include <Kalantha/Core/WorkStealingDeque.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+#include <Tests/Support/TestHelpers.hpp>
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+using namespace kta;
+
+namespace {
+  using kta_tests::ArenaFixture;
+}
+
+TEST_CASE_METHOD(ArenaFixture, "WorkStealingDeque init", "[Core.WorkStealingDeque]") {
+  WorkStealingDeque<int> deque(&arena);
+  REQUIRE(deque.capacity() == 0);
+  REQUIRE(deque.init(6).error().code == ErrC::InvalidArg);
+  REQUIRE(deque.init(8).has_value());
+  REQUIRE(deque.capacity() == 8);
+  REQUIRE_FALSE(deque.init(8).has_value());
+
+  WorkStealingDeque<int> no_alloc;
+  REQUIRE(no_alloc.init(8).error().code == ErrC::NoMemory);
+
+  /// A deque without a buffer has no room, and nothing to take.
+  REQUIRE_FALSE(no_alloc.push(1));
+  REQUIRE_FALSE(no_alloc.pop().has_value());
+  REQUIRE_FALSE(no_alloc.steal().has_value());
+  REQUIRE(no_alloc.empty_approx());
+}
+
+TEST_CASE_METHOD(ArenaFixture, "WorkStealingDeque owner is LIFO, thieves are FIFO", "[Core.WorkStealingDeque]") {
+  WorkStealingDeque<int> deque(&arena);
+  REQUIRE(deque.init(4).has_value());
+  REQUIRE(deque.empty_approx());
+  REQUIRE_FALSE(deque.pop().has_value());
+  REQUIRE_FALSE(deque.steal().has_value());
+
+  for(int i = 1; i <= 4; i++) REQUIRE(deque.push(i));
+  REQUIRE_FALSE(deque.push(5));
+  REQUIRE(deque.size_approx() == 4);
+
+  REQUIRE(deque.pop().value() == 4);
+  REQUIRE(deque.steal().value() == 1);
+  REQUIRE(deque.pop().value() == 3);
+  REQUIRE(deque.steal().value() == 2);
+  REQUIRE_FALSE(deque.pop().has_value());
+  REQUIRE_FALSE(deque.steal().has_value());
+
+  /// Indices keep going past the capacity.
+  for(int round = 0; round < 10; round++) {
+    REQUIRE(deque.push(round));
+    REQUIRE(deque.push(round + 100));
+    REQUIRE(deque.steal().value() == round);
+    REQUIRE(deque.pop().value() == round + 100);
+  }
+  REQUIRE(deque.empty_approx());
+}
+
+TEST_CASE_METHOD(ArenaFixture, "WorkStealingDeque every element is taken exactly once", "[Core.WorkStealingDeque]") {
+  constexpr int total   = 100'000;
+  constexpr int thieves = 3;
+
+  WorkStealingDeque<int> deque(&arena);
+  REQUIRE(deque.init(256).has_value());
+
+  std::vector<std::atomic<int>> seen(total);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+
+  for(int t = 0; t < thieves; t++) {
+    threads.emplace_back([&] {
+      while(!done.load() || !deque.empty_approx()) {
+        if(auto value = deque.steal(); value.has_value()) seen[value.value()].fetch_add(1);
+        else std::this_thread::yield();
+      }
+    });
+  }
+
+  for(int i = 0; i < total; i++) {
+    while(!deque.push(i)) {
+      if(auto value = deque.pop(); value.has_value()) seen[value.value()].fetch_add(1);
+    }
+    if(i % 3 == 0) {
+      if(auto value = deque.pop(); value.has_value()) seen[value.value()].fetch_add(1);
+    }
+  }
+
+  while(auto value = deque.pop()) seen[value.value()].fetch_add(1);
+  done.store(true);
+  for(auto& thread : threads) thread.join();
+
+  bool exactly_once = true;
+  for(auto& count : seen) exactly_once &= count.load() == 1;
+  REQUIRE(exactly_once);
+}
@@ -0,0 +1,34 @@
+/*
+* Copyright (c) 2025 Diago Lima
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#pragma once
+
+#include <Kalantha/Core/Types.hpp>
+#include <Kalantha/Allocators/BumpAllocator.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+* Helpers shared between the test files. not part of the library.
+*/
+
+namespace kta_tests {
+  /// A BumpAllocator over a fresh heap block, for TEST_CASE_METHOD.
+  struct ArenaFixture {
+    static constexpr usize ARENA_SIZE = 1 << 22;
+    std::unique_ptr<uint8[]> buffer = std::make_unique<uint8[]>(ARENA_SIZE);
+    kta::BumpAllocator arena{buffer.get(), buffer.get() + ARENA_SIZE};
+  };
+
+  /// len bytes of noise, the same for the same seed.
+  inline auto random_bytes(usize len, uint64 seed) -> std::vector<uint8> {
+    std::mt19937_64 rng(seed);
+    std::vector<uint8> bytes(len);
+    for(auto& b : bytes) b = static_cast<uint8>(rng());
+    return bytes;
+  }
+}